@@ -30,25 +30,27 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace utils = paal::utils;
 namespace po = boost::program_options;
 using coordinate_t = double;
 using matrix_t = boost::numeric::ublas::matrix<coordinate_t>;
-using fd_t = paal::frequent_directions<matrix_t>;
 
 struct params {
     size_t m_sketch_rows;
     size_t m_sketch_compress_size;
-    //TODO
-    //unsigned m_nthread;
+    unsigned m_nthread;
     size_t m_row_buffer_size;
     bool m_compress_at_end;
+    std::string m_compress_method;
 };
 
+template <typename CompressTag>
 void m_main(po::variables_map const &vm, params const &p,
             std::istream &input_stream, std::ostream &output_stream) {
+    using fd_t = paal::frequent_directions<matrix_t, CompressTag>;
     fd_t fd_sketch;
 
     std::vector<std::vector<coordinate_t>> row_buffer;
@@ -80,20 +82,34 @@ void m_main(po::variables_map const &vm, params const &p,
         rows_count = p.m_sketch_rows;
         columns_count = boost::size(row_buffer.front());
         if(vm.count("sketch_compress_size")) {
-            fd_sketch = paal::make_frequent_directions<coordinate_t>(rows_count, columns_count, p.m_sketch_compress_size);
+            fd_sketch = paal::make_frequent_directions<coordinate_t, CompressTag>(rows_count, columns_count, p.m_sketch_compress_size);
         }
         else {
-            fd_sketch = paal::make_frequent_directions<coordinate_t>(rows_count, columns_count);
+            fd_sketch = paal::make_frequent_directions<coordinate_t, CompressTag>(rows_count, columns_count);
         }
 
-        fd_sketch.update_range(row_buffer);
+        fd_sketch.update_range(row_buffer, p.m_nthread);
     }
 
     while (input_stream.good()) {
         row_buffer.clear();
         paal::read_rows<coordinate_t>
             (input_stream, row_buffer, columns_count, p.m_row_buffer_size, ignore_bad_row);
-        fd_sketch.update_range(row_buffer);
+        fd_sketch.update_range(row_buffer, p.m_nthread);
+    }
+
+    if (vm.count("merge_model")) {
+        for (auto const & model_path : vm["merge_model"].as<std::vector<std::string>>()) {
+            fd_t other_sketch;
+            std::ifstream ifs(model_path);
+            boost::archive::binary_iarchive ia(ifs);
+            ia >> other_sketch;
+            if (other_sketch.get_sketch().first.size2() != columns_count) {
+                utils::failure("Number of columns of the model ", model_path,
+                               " differs from the number of columns of the sketch");
+            }
+            fd_sketch.merge(other_sketch);
+        }
     }
 
     if (p.m_compress_at_end) {
@@ -128,6 +144,8 @@ int main(int argc, char** argv) {
             "\tfrequent-directions -i input_file -r rows -s compress_size --model_out model\n\n"\
             "Then if you want to use this model and add additional data:\n"\
             "\tfrequent-directions -i input_file --model_in model\n\n"\
+            "Sketches computed independently (e.g. on different machines) can be merged into one:\n"\
+            "\tfrequent-directions -i input_file --model_in model --merge_model model2 --merge_model model3\n\n"\
             "Options description");
 
     desc.add_options()
@@ -144,9 +162,14 @@ int main(int argc, char** argv) {
         ("final_compress", po::value<bool>(&p.m_compress_at_end)->default_value(true),
                 "determine if sketch will be compressed after update all data, "\
                 "compression in the final phase is necessary to fulfill sketch approximation ratios")
-    //TODO
-    //    ("nthread,n", po::value<unsigned>(&p.m_nthread)->default_value(std::thread::hardware_concurrency()),
-    //          "number of threads (default = number of cores)")
+        ("compress_method", po::value<std::string>(&p.m_compress_method)->default_value("svd"),
+                "svd - full singular value decomposition, "\
+                "gram - eigendecomposition of the Gram matrix of the sketch, usually faster, "\
+                "(default value = svd)")
+        ("merge_model", po::value<std::vector<std::string>>(), "merge the sketch model from this file into the result, "\
+                "can be used multiple times")
+        ("nthread,n", po::value<unsigned>(&p.m_nthread)->default_value(std::thread::hardware_concurrency()),
+                "number of threads (default = number of cores)")
         ("row_buffer_size", po::value<std::size_t>(&p.m_row_buffer_size)->default_value(100000),
                   "size of row buffer (default value = 100000)")
     ;
@@ -182,6 +205,14 @@ int main(int argc, char** argv) {
         ignored("sketch_compress_size");
     }
 
+    if (p.m_compress_method != "svd" && p.m_compress_method != "gram") {
+        error_with_usage("Unknown compress method: " + p.m_compress_method);
+    }
+
+    if (p.m_nthread <= 0) {
+        error_with_usage("Number of threads must be positive");
+    }
+
     if (p.m_row_buffer_size <= 0) {
         error_with_usage("Size of row buffer must be positive");
     }
@@ -196,9 +227,13 @@ int main(int argc, char** argv) {
         ofs.open(vm["output"].as<std::string>());
     }
 
-    m_main(vm, p,
-           vm.count("input") ? ifs : std::cin,
-           vm.count("output") ? ofs : std::cout);
+    auto &input_stream = vm.count("input") ? ifs : std::cin;
+    auto &output_stream = vm.count("output") ? ofs : std::cout;
+    if (p.m_compress_method == "gram") {
+        m_main<paal::gram_compress_tag>(vm, p, input_stream, output_stream);
+    } else {
+        m_main<paal::svd_compress_tag>(vm, p, input_stream, output_stream);
+    }
 
 
     return EXIT_SUCCESS;
@@ -34,6 +34,8 @@
 #include <boost/range/empty.hpp>
 #include <boost/range/size.hpp>
 
+#include <algorithm>
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <random>
@@ -92,6 +94,7 @@ struct params {
     unsigned m_nthread;
     std::size_t m_dimensions;
     std::size_t m_row_buffer_size;
+    std::size_t m_checkpoint_rows;
     unsigned m_precision;
     int m_seed;
     double m_w;
@@ -115,15 +118,25 @@ auto get_function_generator(jaccard_tag, params const &p) {
     return paal::lsh::jaccard_hash_function_generator(p.m_dimensions, std::default_random_engine(p.m_seed));
 }
 
+template <typename LshFunctionTag>
+auto get_tuple_generator(LshFunctionTag tag, params const &p) {
+    return paal::make_hash_function_tuple_generator(get_function_generator(tag, p), p.m_precision);
+}
+
+// l_p functions of one tuple are evaluated at once by a single matrix-vector product
+auto get_tuple_generator(l1_tag tag, params const &p) {
+    return paal::lsh::make_l_p_hash_function_tuple_generator(get_function_generator(tag, p), p.m_precision);
+}
+
+auto get_tuple_generator(l2_tag tag, params const &p) {
+    return paal::lsh::make_l_p_hash_function_tuple_generator(get_function_generator(tag, p), p.m_precision);
+}
+
 template <typename Row = point_type_sparse, typename LshFunctionTag>
 void m_main(po::variables_map const &vm,
             params const &p,
             LshFunctionTag tag) {
-    using lsh_fun = paal::pure_result_of_t<
-                        paal::hash_function_tuple_generator<
-                                    decltype(get_function_generator(tag, p))
-                                                           >()
-                                          >;
+    using lsh_fun = paal::pure_result_of_t<decltype(get_tuple_generator(tag, p))()>;
     using hash_result = typename std::remove_reference<
         typename std::result_of<lsh_fun(Row)>::type
         >::type;
@@ -147,33 +160,80 @@ void m_main(po::variables_map const &vm,
         assert(metric == p.m_metric);
         assert(dimensions == p.m_dimensions);
     } else {
-        model = paal::make_lsh_nearest_neighbors_regression_tuple_hash(
+        model = paal::make_lsh_nearest_neighbors_regression(
                         points_buffer | transformed(get_coordinates),
                         points_buffer | transformed(get_result),
                         p.m_passes,
-                        get_function_generator(tag, p) , p.m_precision, p.m_nthread);
+                        get_tuple_generator(tag, p), p.m_nthread);
     }
 
+    // the model is written to a temporary file first, so that the model_out file
+    // is always complete, even if the program is killed during checkpointing
+    auto save_model = [&]() {
+        std::string const model_out = vm["model_out"].as<std::string>();
+        std::string const model_tmp = model_out + ".tmp";
+        {
+            std::ofstream ofs(model_tmp);
+            boost::archive::binary_oarchive oa(ofs);
+            oa << p.m_metric;
+            oa << p.m_dimensions;
+            oa << model;
+        }
+        if (std::rename(model_tmp.c_str(), model_out.c_str()) != 0) {
+            utils::failure("could not write the model to ", model_out);
+        }
+    };
+
+    // true if the model_out file holds the current model
+    bool model_saved = false;
+
     auto ignore_bad_row = [&](std::string const &bad_line) {
         utils::warning("following line will be ignored cause of bad format (typically more columns than passed dimensions): ", bad_line);
         return true;
     };
 
     if (vm.count("training_file")) {
-        std::ifstream training_file_stream(vm["training_file"].as<std::string>());
-        if (!training_file_stream.good()) {
+        std::string const training_path = vm["training_file"].as<std::string>();
+        std::ifstream training_file_stream;
+        if (training_path != "-") {
+            training_file_stream.open(training_path);
+        }
+        std::istream &training_stream = (training_path == "-") ? std::cin : training_file_stream;
+        if (!training_stream.good()) {
             utils::failure("training file does not exist or is empty!");
         }
 
+        std::size_t rows_to_checkpoint = p.m_checkpoint_rows;
+        std::size_t rows_trained = 0;
         points_buffer.reserve(p.m_row_buffer_size);
-        while (training_file_stream.good()) {
+        while (training_stream.good()) {
+            auto rows_to_read = p.m_row_buffer_size;
+            if (p.m_checkpoint_rows > 0) {
+                rows_to_read = std::min(rows_to_read, rows_to_checkpoint);
+            }
+
             points_buffer.clear();
             auto dimensions = p.m_dimensions;
-            paal::read_svm(training_file_stream, dimensions, points_buffer, p.m_row_buffer_size, ignore_bad_row);
+            paal::read_svm(training_stream, dimensions, points_buffer, rows_to_read, ignore_bad_row);
 
             model.update(points_buffer | transformed(get_coordinates),
                          points_buffer | transformed(get_result),
                          p.m_nthread);
+            rows_trained += points_buffer.size();
+            if (!points_buffer.empty()) {
+                model_saved = false;
+            }
+
+            if (p.m_checkpoint_rows > 0) {
+                // bad rows and the end of the stream may give fewer rows than requested
+                rows_to_checkpoint -= std::min(rows_to_checkpoint, points_buffer.size());
+                if (rows_to_checkpoint == 0) {
+                    save_model();
+                    model_saved = true;
+                    utils::info("checkpoint after ", rows_trained, " training rows");
+                    rows_to_checkpoint = p.m_checkpoint_rows;
+                }
+            }
         }
     }
 
@@ -221,12 +281,8 @@ void m_main(po::variables_map const &vm,
         }
     }
 
-    if (vm.count("model_out")) {
-        std::ofstream ofs(vm["model_out"].as<std::string>());
-        boost::archive::binary_oarchive oa(ofs);
-        oa << p.m_metric;
-        oa << p.m_dimensions;
-        oa << model;
+    if (vm.count("model_out") && !model_saved) {
+        save_model();
     }
 }
 
@@ -261,12 +317,16 @@ int main(int argc, char** argv)
             "you can use following command:\n"
             "\tlsh-regression -d training.svm -i 7 -n 10 -m L1 --dimensions number_of_dimensions --model_out model.lsh\n\n"\
             "Then if you want to use this model to make a prediction to result_file:\n"\
-            "\tlsh-regression -t test.svm --model_in model.lsh -o results.txt\n\n"
+            "\tlsh-regression -t test.svm --model_in model.lsh -o results.txt\n\n"\
+            "If you want to update this model with training rows from a stream\n"\
+            "and save the model after every million rows, you can use following command:\n"\
+            "\tcat delta.svm | lsh-regression -d - --model_in model.lsh --model_out model.lsh --checkpoint_rows 1000000\n\n"
             "Options description");
 
     desc.add_options()
         ("help,h", "help message")
-        ("training_file,d", po::value<std::string>(), "training file path (in SVM format)")
+        ("training_file,d", po::value<std::string>(), "training file path (in SVM format), " \
+                  "'-' reads training rows from the standard input until the end of the stream")
         ("test_file,t", po::value<std::string>(), "test file path (in SVM format, it doesn't matter what label says)")
         ("model_in", po::value<std::string>(), "path to model, before doing any training or testing")
         ("model_out", po::value<std::string>(), "Write the model to this file when everything is done")
@@ -286,6 +346,9 @@ int main(int argc, char** argv)
                  "should be essentially bigger than radius of expected test point neighborhood")
         ("row_buffer_size", po::value<std::size_t>(&p.m_row_buffer_size)->default_value(100000),
                  "size of row buffer (default value = 100000)")
+        ("checkpoint_rows", po::value<std::size_t>(&p.m_checkpoint_rows)->default_value(0),
+                 "Write the model to model_out after every checkpoint_rows training rows " \
+                 "(default value = 0, the model is written only when everything is done)")
         ("seed", po::value<int>(&p.m_seed)->default_value(0), "Seed of random number generator, (default = random)")
     ;
 
@@ -318,6 +381,10 @@ int main(int argc, char** argv)
         error_with_usage("If you don't set training file (training_file) you have to set input model (model_in)");
     }
 
+    if (p.m_checkpoint_rows > 0 && vm.count("model_out") == 0) {
+        error_with_usage("If you set checkpoint_rows you have to set output model (model_out)");
+    }
+
     if (vm.count("model_in")) {
         Metric m;
         std::size_t dimensions;
@@ -64,6 +64,7 @@ namespace detail {
  * @tparam OutputIterator
  * @tparam ItemToLpIdMap
  * @tparam SeparationOracle
+ * @tparam LP LP implementation used for solving the dual
  * @param auction
  * @param result
  * @param item_to_id Stores the current mapping of items to LP column ids.
@@ -75,7 +76,8 @@ template <
    class DemandQueryAuction,
    class OutputIterator,
    class ItemToLpIdMap,
-   class SeparationOracle = paal::lp::random_violated_separation_oracle
+   class SeparationOracle = paal::lp::random_violated_separation_oracle,
+   class LP = lp::glp
 >
 BOOST_CONCEPT_REQUIRES(
 
@@ -123,7 +125,7 @@ fractional_determine_winners_in_demand_query_auction(
    using bid_t = detail::bid<bidder_t, lp::row_id, bundle_t>;
    using result_t = typename traits_t::result_t;
 
-   lp::glp dual;
+   LP dual;
    dual.set_optimization_type(lp::MINIMIZE);
 
    // add items variables to the dual
@@ -24,6 +24,7 @@
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/functional/hash.hpp>
 
+#include <algorithm>
 #include <unordered_map>
 
 namespace paal {
@@ -239,6 +240,32 @@ class eraseable_bimap : public bimap<T, Idx> {
             m_t_to_id[m_id_to_t[i]] = i;
         }
     }
+
+    /**
+     * @brief erases all given elements (takes linear time for all of them)
+     *
+     * @tparam Range
+     * @param elements
+     */
+    template <typename Range> void erase_all(const Range &elements) {
+        Idx first = base::size();
+        for (auto const &t : elements) {
+            auto iter = m_t_to_id.find(t);
+            assert(iter != m_t_to_id.end());
+            first = std::min(first, iter->second);
+            m_t_to_id.erase(iter);
+        }
+
+        Idx idx = first;
+        for (int i : irange(first, Idx(m_id_to_t.size()))) {
+            auto iter = m_t_to_id.find(m_id_to_t[i]);
+            if (iter != m_t_to_id.end()) {
+                iter->second = idx;
+                m_id_to_t[idx++] = m_id_to_t[i];
+            }
+        }
+        m_id_to_t.resize(idx);
+    }
 };
 
 /**
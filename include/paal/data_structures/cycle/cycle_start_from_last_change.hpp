@@ -74,6 +74,26 @@ template <typename Cycle> class cycle_start_from_last_change {
      */
     vertex_iterator vend() const { return m_cycle.vend(); }
 
+    /**
+     * @brief next element in the cycle,
+     * available if the underlying cycle provides it
+     *
+     * @param ce
+     *
+     * @return
+     */
+    CycleElem next(const CycleElem &ce) const { return m_cycle.next(ce); }
+
+    /**
+     * @brief previous element in the cycle,
+     * available if the underlying cycle provides it
+     *
+     * @param ce
+     *
+     * @return
+     */
+    CycleElem prev(const CycleElem &ce) const { return m_cycle.prev(ce); }
+
     /**
      * @brief cycle getter
      *
@@ -96,6 +96,17 @@ template <typename CycleEl, typename IdxT = int> class simple_cycle {
         return from_idx(next_idx(to_idx(ce)));
     }
 
+    /**
+     * @brief previous element in the cycle
+     *
+     * @param ce
+     *
+     * @return
+     */
+    CycleEl prev(const CycleEl &ce) const {
+        return from_idx(prev_idx(to_idx(ce)));
+    }
+
     // TODO use iterator_fascade
     /**
      * @brief iterator over vertices of the cycle
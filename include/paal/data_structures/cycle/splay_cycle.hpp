@@ -101,6 +101,32 @@ public:
         }
     }
 
+    /**
+     * @brief next element in the cycle
+     *
+     * @param t
+     *
+     * @return
+     */
+    T next(const T &t) const {
+        std::size_t i = m_splay_tree.get_idx(t);
+        assert(i != std::size_t(-1));
+        return m_splay_tree[i + 1 == m_size ? 0 : i + 1];
+    }
+
+    /**
+     * @brief previous element in the cycle
+     *
+     * @param t
+     *
+     * @return
+     */
+    T prev(const T &t) const {
+        std::size_t i = m_splay_tree.get_idx(t);
+        assert(i != std::size_t(-1));
+        return m_splay_tree[i == 0 ? m_size - 1 : i - 1];
+    }
+
   private:
     splay_tree<T> m_splay_tree;
     const std::size_t m_size;
@@ -0,0 +1,395 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file two_level_cycle.hpp
+ * @brief cycle stored as a list of segments with reverse bits
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_TWO_LEVEL_CYCLE_HPP
+#define PAAL_TWO_LEVEL_CYCLE_HPP
+
+#include "paal/data_structures/bimap.hpp"
+
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace paal {
+namespace data_structures {
+
+/**
+ * @class two_level_cycle
+ * @brief Implementation of the \ref cycle concept as a two level list:
+ * the cycle is split into segments of about sqrt(n) elements, every segment
+ * is an array with its own reverse bit, segments form a cyclic array.
+ * Flip splits at most two segments, reverses the order of the segments
+ * on the shorter side of the cycle and merges small neighboring segments,
+ * so it costs O(sqrt(n)). next/prev are O(1) and touch consecutive memory.
+ *
+ * @tparam CycleEl
+ */
+template <typename CycleEl> class two_level_cycle {
+    using idx_t = int;
+
+    struct segment {
+        std::vector<idx_t> m_elements;
+        bool m_reversed = false;
+    };
+
+  public:
+    /**
+     * @brief iterator over vertices of the cycle
+     */
+    class vertex_iterator
+        : public boost::iterator_facade<vertex_iterator, const CycleEl,
+                                        boost::forward_traversal_tag> {
+      public:
+        vertex_iterator() = default;
+
+        /**
+         * @brief constructor
+         *
+         * @param cycle
+         * @param ce first element
+         */
+        vertex_iterator(const two_level_cycle &cycle, const CycleEl &ce)
+            : m_cycle(&cycle), m_idx(cycle.to_idx(ce)), m_first(m_idx) {}
+
+      private:
+        friend class boost::iterator_core_access;
+
+        void increment() {
+            m_idx = m_cycle->next_idx(m_idx);
+            if (m_idx == m_first) {
+                m_idx = -1;
+            }
+        }
+
+        bool equal(const vertex_iterator &other) const { return m_idx == other.m_idx; }
+
+        const CycleEl &dereference() const { return m_cycle->from_idx(m_idx); }
+
+        const two_level_cycle *m_cycle = nullptr;
+        idx_t m_idx = -1;
+        idx_t m_first = -1;
+    };
+
+    /**
+     * @brief constructor
+     *
+     * @tparam Iter
+     * @param begin
+     * @param end
+     */
+    template <typename Iter> two_level_cycle(Iter begin, Iter end) {
+        for (; begin != end; ++begin) {
+            m_idx.add(*begin);
+        }
+        auto const n = m_idx.size();
+        m_max_segment_size = std::max<std::size_t>(8, std::sqrt(double(n)));
+        m_segment_of.resize(n);
+        m_position.resize(n);
+        for (std::size_t first = 0; first < n; first += m_max_segment_size) {
+            auto s = new_segment();
+            auto last = std::min(n, first + m_max_segment_size);
+            for (auto i = first; i < last; ++i) {
+                m_segments[s].m_elements.push_back(i);
+            }
+            update_elements(s, 0);
+            m_rank[s] = m_order.size();
+            m_order.push_back(s);
+        }
+    }
+
+    /**
+     * @brief number of elements in the cycle
+     *
+     * @return
+     */
+    std::size_t size() const { return m_idx.size(); }
+
+    /**
+     * @brief next element in the cycle
+     *
+     * @param ce
+     *
+     * @return
+     */
+    CycleEl next(const CycleEl &ce) const { return from_idx(next_idx(to_idx(ce))); }
+
+    /**
+     * @brief previous element in the cycle
+     *
+     * @param ce
+     *
+     * @return
+     */
+    CycleEl prev(const CycleEl &ce) const { return from_idx(prev_idx(to_idx(ce))); }
+
+    /// after flip the order will be reversed, ie it will be from 'end'  to
+    /// 'begin'
+    void flip(const CycleEl &begin, const CycleEl &end) {
+        idx_t b = to_idx(begin);
+        idx_t e = to_idx(end);
+        if (m_reversed) {
+            // the path from begin to end is the physical path from end to begin
+            std::swap(b, e);
+        }
+        physical_flip(b, e);
+    }
+
+    /**
+     * @brief begin of the vertices range starting at el
+     *
+     * @param el
+     *
+     * @return
+     */
+    vertex_iterator vbegin(const CycleEl &el) const { return vertex_iterator(*this, el); }
+
+    /**
+     * @brief begin of the vertices range
+     *
+     * @return
+     */
+    vertex_iterator vbegin() const { return vbegin(from_idx(0)); }
+
+    /**
+     * @brief end of the vertices range
+     *
+     * @return
+     */
+    vertex_iterator vend() const { return vertex_iterator(); }
+
+    /**
+     * @brief number of segments, for tests and benchmarks
+     *
+     * @return
+     */
+    std::size_t segments_count() const { return m_order.size(); }
+
+  private:
+    idx_t to_idx(const CycleEl &ce) const { return m_idx.get_idx(ce); }
+
+    const CycleEl &from_idx(idx_t i) const { return m_idx.get_val(i); }
+
+    idx_t next_idx(idx_t i) const {
+        return m_reversed ? physical_prev(i) : physical_next(i);
+    }
+
+    idx_t prev_idx(idx_t i) const {
+        return m_reversed ? physical_next(i) : physical_prev(i);
+    }
+
+    // physical order: segments in m_order, elements of the segment in the
+    // array order, or in the reversed order if the segment is reversed
+
+    std::size_t next_rank(std::size_t r) const {
+        return r + 1 == m_order.size() ? 0 : r + 1;
+    }
+
+    std::size_t prev_rank(std::size_t r) const {
+        return r == 0 ? m_order.size() - 1 : r - 1;
+    }
+
+    idx_t first_of(std::size_t s) const {
+        auto const &seg = m_segments[s];
+        return seg.m_reversed ? seg.m_elements.back() : seg.m_elements.front();
+    }
+
+    idx_t last_of(std::size_t s) const {
+        auto const &seg = m_segments[s];
+        return seg.m_reversed ? seg.m_elements.front() : seg.m_elements.back();
+    }
+
+    idx_t physical_next(idx_t i) const {
+        auto s = m_segment_of[i];
+        auto const &seg = m_segments[s];
+        auto p = m_position[i];
+        if (seg.m_reversed) {
+            if (p > 0) return seg.m_elements[p - 1];
+        } else {
+            if (p + 1 < seg.m_elements.size()) return seg.m_elements[p + 1];
+        }
+        return first_of(m_order[next_rank(m_rank[s])]);
+    }
+
+    idx_t physical_prev(idx_t i) const {
+        auto s = m_segment_of[i];
+        auto const &seg = m_segments[s];
+        auto p = m_position[i];
+        if (seg.m_reversed) {
+            if (p + 1 < seg.m_elements.size()) return seg.m_elements[p + 1];
+        } else {
+            if (p > 0) return seg.m_elements[p - 1];
+        }
+        return last_of(m_order[prev_rank(m_rank[s])]);
+    }
+
+    /// reverses the physical path from b to e
+    void physical_flip(idx_t b, idx_t e) {
+        if (b == e) return;
+        // after splits the path consists of whole segments
+        split_after(e);
+        split_before(b);
+        auto first = m_rank[m_segment_of[b]];
+        auto last = m_rank[m_segment_of[e]];
+        auto const segments = m_order.size();
+        auto const path = (last + segments - first) % segments + 1;
+        if (path == segments) {
+            m_reversed = !m_reversed;
+        } else if (2 * path <= segments) {
+            reverse_segments(first, path);
+        } else {
+            // reversing the complement of the path and the whole cycle
+            // gives the same cycle
+            reverse_segments(next_rank(last), segments - path);
+            m_reversed = !m_reversed;
+        }
+
+        // merges segments around the borders of the path
+        for (auto i : {b, e}) {
+            auto s = m_segment_of[i];
+            merge_with_next(m_order[prev_rank(m_rank[s])]);
+            s = m_segment_of[i];
+            merge_with_next(s);
+        }
+    }
+
+    /// reverses count segments starting from the rank first
+    void reverse_segments(std::size_t first, std::size_t count) {
+        auto const segments = m_order.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            m_segments[m_order[(first + i) % segments]].m_reversed ^= true;
+        }
+        for (std::size_t i = 0, j = count - 1; i < j; ++i, --j) {
+            std::swap(m_order[(first + i) % segments], m_order[(first + j) % segments]);
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            auto r = (first + i) % segments;
+            m_rank[m_order[r]] = r;
+        }
+    }
+
+    /// makes the array order of the segment equal to the physical order
+    void normalize(std::size_t s) {
+        auto &seg = m_segments[s];
+        if (seg.m_reversed) {
+            std::reverse(seg.m_elements.begin(), seg.m_elements.end());
+            seg.m_reversed = false;
+            update_elements(s, 0);
+        }
+    }
+
+    /// i becomes the first element of its segment
+    void split_before(idx_t i) {
+        auto s = m_segment_of[i];
+        normalize(s);
+        split(s, m_position[i]);
+    }
+
+    /// i becomes the last element of its segment
+    void split_after(idx_t i) {
+        auto s = m_segment_of[i];
+        normalize(s);
+        split(s, m_position[i] + 1);
+    }
+
+    /// elements from position pos are moved to the new segment after s
+    void split(std::size_t s, std::size_t pos) {
+        if (pos == 0 || pos == m_segments[s].m_elements.size()) return;
+        auto ns = new_segment();
+        auto &elements = m_segments[s].m_elements;
+        m_segments[ns].m_elements.assign(elements.begin() + pos, elements.end());
+        elements.resize(pos);
+        update_elements(ns, 0);
+        insert_segment(ns, m_rank[s] + 1);
+    }
+
+    /// merges s with the next segment if they are small enough
+    void merge_with_next(std::size_t s) {
+        if (m_order.size() == 1) return;
+        auto ns = m_order[next_rank(m_rank[s])];
+        auto &elements = m_segments[s].m_elements;
+        auto &next_elements = m_segments[ns].m_elements;
+        if (elements.size() + next_elements.size() > m_max_segment_size) return;
+        normalize(s);
+        normalize(ns);
+        auto const old_size = elements.size();
+        elements.insert(elements.end(), next_elements.begin(), next_elements.end());
+        update_elements(s, old_size);
+        erase_segment(ns);
+    }
+
+    /// updates segment and position of elements of the segment s from position pos
+    void update_elements(std::size_t s, std::size_t pos) {
+        auto const &elements = m_segments[s].m_elements;
+        for (auto i = pos; i < elements.size(); ++i) {
+            m_segment_of[elements[i]] = s;
+            m_position[elements[i]] = i;
+        }
+    }
+
+    std::size_t new_segment() {
+        if (!m_free_segments.empty()) {
+            auto s = m_free_segments.back();
+            m_free_segments.pop_back();
+            return s;
+        }
+        m_segments.emplace_back();
+        m_rank.push_back(0);
+        return m_segments.size() - 1;
+    }
+
+    void insert_segment(std::size_t s, std::size_t rank) {
+        m_order.insert(m_order.begin() + rank, s);
+        for (auto r = rank; r < m_order.size(); ++r) {
+            m_rank[m_order[r]] = r;
+        }
+    }
+
+    void erase_segment(std::size_t s) {
+        auto rank = m_rank[s];
+        m_order.erase(m_order.begin() + rank);
+        for (auto r = rank; r < m_order.size(); ++r) {
+            m_rank[m_order[r]] = r;
+        }
+        m_segments[s].m_elements.clear();
+        m_segments[s].m_reversed = false;
+        m_free_segments.push_back(s);
+    }
+
+    /// mapping from elements to indexes
+    bimap<CycleEl, idx_t> m_idx;
+    /// segment of the element
+    std::vector<std::size_t> m_segment_of;
+    /// position of the element in the array of its segment
+    std::vector<std::size_t> m_position;
+    std::vector<segment> m_segments;
+    /// position of the segment in m_order
+    std::vector<std::size_t> m_rank;
+    /// cyclic order of the segments
+    std::vector<std::size_t> m_order;
+    std::vector<std::size_t> m_free_segments;
+    std::size_t m_max_segment_size;
+    /// the whole cycle is read in the reversed physical order
+    bool m_reversed = false;
+};
+
+} //! data_structures
+} //! paal
+
+#endif // PAAL_TWO_LEVEL_CYCLE_HPP
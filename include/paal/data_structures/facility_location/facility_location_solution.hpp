@@ -84,6 +84,9 @@ public:
         return -m_fac_costs(f) + m_voronoi.rem_generator(f);
     }
 
+    /// returns cost of opening facility f
+    Dist get_facility_cost(VertexType f) const { return m_fac_costs(f); }
+
     /// getter for unchosen facilities
     const UnchosenFacilitiesSet &get_unchosen_facilities() const {
         return m_unchosen_facilities;
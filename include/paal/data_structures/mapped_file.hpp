@@ -27,7 +27,9 @@
 #include "paal/data_structures/thread_pool.hpp"
 
 #include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <thread>
@@ -96,6 +98,27 @@ public:
         return std::string(result_begin, result_end-result_begin);
     }
 
+    /**
+     * @brief Gets line from the m_current file without copying it.
+     *        Eof and End Of Chunk aren't checked here.
+     *
+     * @return range of the line characters (without the new line character)
+     */
+    boost::iterator_range<char const *> get_line_range() {
+        auto result_begin = m_current;
+        auto result_end = std::find(m_current, m_file_end, '\n');
+
+        m_current = result_end + 1;
+        return boost::make_iterator_range(result_begin, result_end);
+    }
+
+    /**
+     * @brief offset of the m_current position from the beginning of the file
+     */
+    std::size_t offset() const {
+        return m_current - m_file_begin;
+    }
+
     /**
      * @brief is m_currently at the end of file
      */
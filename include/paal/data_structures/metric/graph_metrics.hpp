@@ -17,9 +17,23 @@
 
 #include "basic_metrics.hpp"
 
-#include <boost/graph/johnson_all_pairs_shortest.hpp>
-#include <boost/graph/floyd_warshall_shortest.hpp>
+#include "paal/data_structures/thread_pool.hpp"
+
 #include <boost/graph/adjacency_matrix.hpp>
+#include <boost/graph/dijkstra_shortest_paths_no_color_map.hpp>
+#include <boost/graph/floyd_warshall_shortest.hpp>
+#include <boost/graph/johnson_all_pairs_shortest.hpp>
+#include <boost/property_map/property_map.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace paal {
 namespace data_structures {
@@ -27,6 +41,7 @@ namespace data_structures {
 namespace graph_type {
 class sparse_tag;
 class dense_tag;
+class parallel_tag;
 class large_tag;
 }
 
@@ -78,6 +93,60 @@ template <> struct graph_metric_filler_impl<graph_type::dense_tag> {
     }
 };
 
+/**
+ * @brief specialization strategies of computing metric for parallel_tag graphs,
+ *        Dijkstra is run from every vertex, sources are distributed among threads
+ *        and every run writes directly to its row of the matrix.
+ *        Edge weights have to be nonnegative.
+ */
+template <> struct graph_metric_filler_impl<graph_type::parallel_tag> {
+    /**
+     * @brief constructor
+     *
+     * @param threads_count
+     */
+    graph_metric_filler_impl(
+        unsigned threads_count = std::thread::hardware_concurrency())
+        : m_threads_count(std::max(threads_count, 1u)) {}
+
+    /**
+     * @brief fill_matrix function
+     *
+     * @tparam Graph
+     * @tparam ResultMatrix
+     * @param g
+     * @param rm
+     */
+    template <typename Graph, typename ResultMatrix>
+    void fill_matrix(const Graph &g, ResultMatrix &rm) {
+        using vertex_t = typename boost::graph_traits<Graph>::vertex_descriptor;
+        auto vertex_range = vertices(g);
+        std::vector<vertex_t> sources(vertex_range.first, vertex_range.second);
+        if (sources.empty()) return;
+
+        auto index = get(boost::vertex_index, g);
+        std::atomic<std::size_t> next_source{ 0 };
+        auto const threads_count =
+            std::min<std::size_t>(m_threads_count, sources.size());
+        thread_pool threads(threads_count);
+        for (std::size_t i = 0; i < threads_count; ++i) {
+            threads.post([&]() {
+                for (auto s = next_source++; s < sources.size(); s = next_source++) {
+                    auto source = sources[s];
+                    boost::dijkstra_shortest_paths_no_color_map(
+                        g, source,
+                        boost::distance_map(boost::make_iterator_property_map(
+                            &rm[get(index, source)][0], index)));
+                }
+            });
+        }
+        threads.run();
+    }
+
+  private:
+    unsigned m_threads_count;
+};
+
 /**
  * @class graph_metric
  * @brief Adopts boost graph as \ref metric.
@@ -92,11 +161,9 @@ template <
     typename Graph, typename DistanceType,
     typename GraphType = typename graph_metric_traits<Graph>::graph_tag_type>
 struct graph_metric : public array_metric<DistanceType>,
-                      public graph_metric_filler_impl<
-                          typename graph_metric_traits<Graph>::graph_tag_type> {
+                      public graph_metric_filler_impl<GraphType> {
     typedef array_metric<DistanceType> GMBase;
-    typedef graph_metric_filler_impl<
-        typename graph_metric_traits<Graph>::graph_tag_type> GMFBase;
+    typedef graph_metric_filler_impl<GraphType> GMFBase;
 
     /**
      * @brief constructor
@@ -106,20 +173,148 @@ struct graph_metric : public array_metric<DistanceType>,
     graph_metric(const Graph &g) : GMBase(num_vertices(g)) {
         GMFBase::fill_matrix(g, GMBase::m_matrix);
     }
+
+    /**
+     * @brief constructor with configured filler,
+     *        e.g. graph_metric_filler_impl<graph_type::parallel_tag>(threads_count)
+     *
+     * @param g
+     * @param filler
+     */
+    graph_metric(const Graph &g, GMFBase filler)
+        : GMBase(num_vertices(g)), GMFBase(std::move(filler)) {
+        GMFBase::fill_matrix(g, GMBase::m_matrix);
+    }
 };
 
-// TODO implement
-/// Specialization for large graphs
+/**
+ * @brief Specialization for large graphs. Rows of the metric (distances from
+ *        one source) are computed by Dijkstra on demand and kept in LRU cache,
+ *        so the memory usage is bounded by the given budget instead of O(V^2).
+ *        Edge weights have to be nonnegative.
+ *
+ *        The metric is thread safe, rows are computed outside of the lock,
+ *        so threads missing the cache do not block each other.
+ *        Copies of the metric share the graph and the cache.
+ *
+ * @tparam Graph
+ * @tparam DistanceType
+ */
 template <typename Graph, typename DistanceType>
 struct graph_metric<Graph, DistanceType, graph_type::large_tag> {
+  private:
+    using vertex_t = typename boost::graph_traits<Graph>::vertex_descriptor;
+    using row_t = std::vector<DistanceType>;
+    using row_ptr = std::shared_ptr<row_t const>;
+    using lru_list = std::list<std::pair<std::size_t, row_ptr>>;
+
+    struct state {
+        state(Graph graph, std::size_t max_rows)
+            : m_graph(std::move(graph)), m_max_rows(max_rows) {}
+
+        Graph const m_graph;
+        std::size_t const m_max_rows;
+        std::mutex m_mutex;
+        // most recently used row at the front
+        lru_list m_rows;
+        std::unordered_map<std::size_t, typename lru_list::iterator> m_row_positions;
+    };
+
+    std::shared_ptr<state> m_state;
+
+    row_ptr compute_row(vertex_t source) const {
+        auto const &g = m_state->m_graph;
+        auto row = std::make_shared<row_t>(num_vertices(g));
+        boost::dijkstra_shortest_paths_no_color_map(
+            g, source,
+            boost::distance_map(boost::make_iterator_property_map(
+                row->begin(), get(boost::vertex_index, g))));
+        return row;
+    }
+
+    row_ptr get_row(vertex_t source) const {
+        auto const index = get(boost::vertex_index, m_state->m_graph, source);
+        {
+            std::lock_guard<std::mutex> lock(m_state->m_mutex);
+            auto position = m_state->m_row_positions.find(index);
+            if (position != m_state->m_row_positions.end()) {
+                auto &rows = m_state->m_rows;
+                rows.splice(rows.begin(), rows, position->second);
+                return position->second->second;
+            }
+        }
+
+        auto row = compute_row(source);
+
+        std::lock_guard<std::mutex> lock(m_state->m_mutex);
+        auto &rows = m_state->m_rows;
+        auto &positions = m_state->m_row_positions;
+        auto position = positions.find(index);
+        // other thread could compute the same row in the meantime
+        if (position != positions.end()) {
+            rows.splice(rows.begin(), rows, position->second);
+            return position->second->second;
+        }
+        rows.emplace_front(index, row);
+        positions.emplace(index, rows.begin());
+        if (rows.size() > m_state->m_max_rows) {
+            positions.erase(rows.back().first);
+            rows.pop_back();
+        }
+        return row;
+    }
+
+  public:
+    /// default memory budget of the cache in bytes
+    static const std::size_t default_memory_budget = std::size_t(1) << 30;
+
     /**
      * @brief constructor
      *
      * @param g
+     * @param memory_budget maximal size of cached rows in bytes,
+     *        at least one row is always cached
+     */
+    graph_metric(Graph g, std::size_t memory_budget = default_memory_budget) {
+        auto const row_size = std::max<std::size_t>(num_vertices(g), 1) * sizeof(DistanceType);
+        auto const max_rows = std::max<std::size_t>(memory_budget / row_size, 1);
+        m_state = std::make_shared<state>(std::move(g), max_rows);
+    }
+
+    /**
+     * @brief returns distance between v and w
+     *
+     * @param v
+     * @param w
+     *
+     * @return
      */
-    graph_metric(const Graph &g) { assert(false); }
+    DistanceType operator()(const vertex_t &v, const vertex_t &w) const {
+        return (*get_row(v))[get(boost::vertex_index, m_state->m_graph, w)];
+    }
+
+    /// returns number of vertices
+    int size() const { return num_vertices(m_state->m_graph); }
+
+    /// maximal number of cached rows
+    std::size_t max_cached_rows() const { return m_state->m_max_rows; }
+
+    /// current number of cached rows
+    std::size_t cached_rows() const {
+        std::lock_guard<std::mutex> lock(m_state->m_mutex);
+        return m_state->m_rows.size();
+    }
+
+    /// operator==, true for copies of the same metric
+    bool operator==(const graph_metric &other) const {
+        return m_state == other.m_state;
+    }
 };
 
+template <typename Graph, typename DistanceType>
+const std::size_t
+    graph_metric<Graph, DistanceType, graph_type::large_tag>::default_memory_budget;
+
 /// Specialization for adjacency_list
 template <typename OutEdgeList, typename VertexList, typename Directed,
           typename VertexProperties, typename EdgeProperties,
@@ -0,0 +1,315 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file open_addressing_map.hpp
+ * @brief flat hash map with fixed width integer keys
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_OPEN_ADDRESSING_MAP_HPP
+#define PAAL_OPEN_ADDRESSING_MAP_HPP
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace paal {
+namespace data_structures {
+
+/**
+ * @brief single slot of open_addressing_map
+ *
+ * @tparam Value
+ * @tparam Key
+ */
+template <typename Value, typename Key>
+struct open_addressing_map_slot {
+    ///key, meaningful only if the slot is occupied
+    Key key = 0;
+    ///value
+    Value value = Value{};
+    ///is the slot occupied (nonzero), one byte wide so that any byte
+    ///read from a mapped file is a valid value
+    std::uint8_t occupied = 0;
+
+    ///serialize
+    template<class Archive>
+    void serialize(Archive & ar, const unsigned int version) {
+        ar & key;
+        ar & value;
+        ar & occupied;
+    }
+};
+
+namespace detail {
+
+inline std::size_t mix_open_addressing_key(std::uint64_t k) {
+    //murmur3 finalizer, keys are often outputs of weak hash functions
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return static_cast<std::size_t>(k);
+}
+
+///accepts every value with the searched key
+struct open_addressing_any_value {
+    ///operator()
+    template <typename Value>
+    bool operator()(Value const &) const { return true; }
+};
+
+/// returns the slot containing key and value accepted by equal
+/// or the empty slot where such element should be inserted,
+/// capacity if all the slots were probed (possible only for corrupted slots)
+template <typename Value, typename Key, typename Equal>
+std::size_t find_open_addressing_slot(open_addressing_map_slot<Value, Key> const * slots,
+                                      std::size_t capacity, Key key, Equal const & equal) {
+    assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+    std::size_t const mask = capacity - 1;
+    auto i = mix_open_addressing_key(key) & mask;
+    for (std::size_t probes = 0; probes < capacity; ++probes) {
+        if (!slots[i].occupied || (slots[i].key == key && equal(slots[i].value))) {
+            return i;
+        }
+        i = (i + 1) & mask;
+    }
+    return capacity;
+}
+
+/// finds value for the given key accepted by equal, nullptr if it is not present
+template <typename Value, typename Key, typename Equal>
+Value const * find_in_open_addressing_slots(open_addressing_map_slot<Value, Key> const * slots,
+                                            std::size_t capacity, Key key, Equal const & equal) {
+    if (capacity == 0) return nullptr;
+    auto const i = find_open_addressing_slot(slots, capacity, key, equal);
+    if (i == capacity) return nullptr;
+    auto const & s = slots[i];
+    return s.occupied ? &s.value : nullptr;
+}
+
+} //!detail
+
+/**
+ * @brief Hash map with unsigned integer keys stored in one contiguous array
+ * of slots (linear probing, power of two capacity).
+ * Contrary to node based maps, insertion does not allocate (besides rehashing)
+ * and a lookup touches consecutive memory only.
+ *
+ * Elements cannot be removed.
+ *
+ * Many elements can share the same key, if they are distinguished by
+ * the equality predicate passed to find and insert, e.g. when the key is
+ * only a fingerprint of the full key stored in the value.
+ *
+ * @tparam Value
+ * @tparam Key unsigned integer type
+ */
+template <typename Value, typename Key = std::uint64_t>
+class open_addressing_map {
+    static_assert(std::is_unsigned<Key>::value, "Key has to be unsigned integer");
+
+public:
+    ///single slot of the table
+    using slot = open_addressing_map_slot<Value, Key>;
+
+private:
+    std::vector<slot> m_slots;
+    std::size_t m_size = 0;
+
+    //maximal load factor is 3/4
+    static bool too_loaded(std::size_t size, std::size_t capacity) {
+        return 4 * size > 3 * capacity;
+    }
+
+    void rehash(std::size_t capacity) {
+        assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+        std::vector<slot> old_slots(capacity);
+        old_slots.swap(m_slots);
+        for (auto & s : old_slots) {
+            if (s.occupied) {
+                // the moved elements are different, so the first empty slot is taken
+                auto never_equal = [](Value const &) { return false; };
+                m_slots[detail::find_open_addressing_slot(m_slots.data(), m_slots.size(),
+                                                          s.key, never_equal)] = std::move(s);
+            }
+        }
+    }
+
+public:
+
+    ///constructor
+    open_addressing_map() = default;
+
+    ///number of elements
+    std::size_t size() const { return m_size; }
+
+    ///is empty
+    bool empty() const { return m_size == 0; }
+
+    ///number of slots
+    std::size_t capacity() const { return m_slots.size(); }
+
+    ///slots of the table, including empty ones
+    std::vector<slot> const & slots() const { return m_slots; }
+
+    ///makes room for size elements without rehashing
+    void reserve(std::size_t size) {
+        std::size_t capacity = m_slots.empty() ? 8 : m_slots.size();
+        while (too_loaded(size, capacity)) capacity *= 2;
+        if (capacity != m_slots.size()) rehash(capacity);
+    }
+
+    /**
+     * @brief finds value for the given key
+     *
+     * @param key
+     *
+     * @return pointer to the value or nullptr if key is not present
+     */
+    Value const * find(Key key) const {
+        return find(key, detail::open_addressing_any_value{});
+    }
+
+    /**
+     * @brief finds value for the given key accepted by the predicate
+     *
+     * @param key
+     * @param equal predicate on values
+     *
+     * @return pointer to the value or nullptr if it is not present
+     */
+    template <typename Equal>
+    Value const * find(Key key, Equal const & equal) const {
+        return detail::find_in_open_addressing_slots(m_slots.data(), m_slots.size(), key, equal);
+    }
+
+    /// returns value for the given key, inserts Value{} if key is not present
+    Value & operator[](Key key) {
+        return *insert(key, detail::open_addressing_any_value{}).first;
+    }
+
+    /**
+     * @brief finds value for the given key accepted by the predicate,
+     * inserts Value{} if it is not present
+     *
+     * @param key
+     * @param equal predicate on values
+     *
+     * @return pointer to the value and true if it was inserted
+     */
+    template <typename Equal>
+    std::pair<Value *, bool> insert(Key key, Equal const & equal) {
+        reserve(m_size + 1);
+        auto & s = m_slots[detail::find_open_addressing_slot(m_slots.data(), m_slots.size(),
+                                                             key, equal)];
+        bool const inserted = !s.occupied;
+        if (inserted) {
+            s.key = key;
+            s.occupied = 1;
+            ++m_size;
+        }
+        return std::make_pair(&s.value, inserted);
+    }
+
+    ///operator==, compares content only (the order of slots is irrelevant)
+    bool operator==(open_addressing_map const & other) const {
+        if (m_size != other.m_size) return false;
+        for (auto const & s : m_slots) {
+            if (!s.occupied) continue;
+            auto other_value = other.find(s.key, [&](Value const & v) { return v == s.value; });
+            if (!other_value) return false;
+        }
+        return true;
+    }
+
+    ///serialize
+    template<class Archive>
+    void serialize(Archive & ar, const unsigned int version) {
+        ar & m_slots;
+        ar & m_size;
+    }
+};
+
+/**
+ * @brief Read only view of slots laid out as in open_addressing_map,
+ * e.g. slots stored in a memory mapped file.
+ * The view does not copy the slots, the memory is kept alive by the owner pointer.
+ *
+ * @tparam Value
+ * @tparam Key unsigned integer type
+ */
+template <typename Value, typename Key = std::uint64_t>
+class open_addressing_map_view {
+public:
+    ///single slot of the table
+    using slot = open_addressing_map_slot<Value, Key>;
+
+private:
+    slot const * m_slots = nullptr;
+    std::size_t m_capacity = 0;
+    std::size_t m_size = 0;
+    std::shared_ptr<void const> m_owner;
+
+public:
+    ///constructor
+    open_addressing_map_view() = default;
+
+    /**
+     * @brief constructor
+     *
+     * @param slots beginning of the slots array
+     * @param capacity number of slots, power of two
+     * @param size number of non empty slots
+     * @param owner object owning the memory of slots
+     */
+    open_addressing_map_view(slot const * slots, std::size_t capacity,
+                             std::size_t size, std::shared_ptr<void const> owner) :
+        m_slots(slots), m_capacity(capacity), m_size(size), m_owner(std::move(owner)) {
+        assert(capacity == 0 || (capacity & (capacity - 1)) == 0);
+    }
+
+    ///number of elements
+    std::size_t size() const { return m_size; }
+
+    ///is empty
+    bool empty() const { return m_size == 0; }
+
+    ///number of slots
+    std::size_t capacity() const { return m_capacity; }
+
+    ///slots of the table, including empty ones
+    boost::iterator_range<slot const *> slots() const {
+        return boost::make_iterator_range(m_slots, m_slots + m_capacity);
+    }
+
+    ///finds value for the given key, nullptr if key is not present
+    Value const * find(Key key) const {
+        return find(key, detail::open_addressing_any_value{});
+    }
+
+    ///finds value for the given key accepted by the predicate, nullptr if it is not present
+    template <typename Equal>
+    Value const * find(Key key, Equal const & equal) const {
+        return detail::find_in_open_addressing_slots(m_slots, m_capacity, key, equal);
+    }
+};
+
+} //!data_structures
+} //!paal
+
+#endif // PAAL_OPEN_ADDRESSING_MAP_HPP
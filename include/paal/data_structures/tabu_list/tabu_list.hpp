@@ -15,10 +15,14 @@
 #ifndef PAAL_TABU_LIST_HPP
 #define PAAL_TABU_LIST_HPP
 
+#include "paal/utils/functors.hpp"
+
 #include <boost/functional/hash.hpp>
 
+#include <cassert>
 #include <unordered_set>
 #include <queue>
+#include <vector>
 
 namespace paal {
 namespace data_structures {
@@ -129,6 +133,89 @@ class tabu_list_remember_solution_and_move
     }
 };
 
+/**
+ * @brief Tabu list for moves described by dense integer attributes
+ *        (e.g. index of the changed element).
+ *        For each attribute it stores the iteration until which
+ *        the attribute is tabu, so is_tabu is one comparison
+ *        and there are no allocations.
+ *        The move is tabu until tenure other moves are accepted.
+ *
+ * @tparam GetAttribute functor move -> attribute in [0, attributes_count)
+ */
+template <typename GetAttribute = utils::identity_functor>
+class tabu_list_attribute {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param attributes_count
+     * @param tenure
+     * @param get_attribute
+     */
+    tabu_list_attribute(std::size_t attributes_count, unsigned tenure,
+                        GetAttribute get_attribute = GetAttribute())
+        : m_tabu_until(attributes_count, 0), m_tenure(tenure),
+          m_get_attribute(std::move(get_attribute)) {}
+
+    /**
+     * @brief is tabu member function
+     *
+     * @tparam Solution
+     * @tparam Move
+     * @param move
+     *
+     * @return
+     */
+    template <typename Solution, typename Move>
+    bool is_tabu(const Solution &, const Move &move) const {
+        return m_iteration < m_tabu_until[attribute(move)];
+    }
+
+    /**
+     * @brief accept member function
+     *
+     * @tparam Solution
+     * @tparam Move
+     * @param move
+     */
+    template <typename Solution, typename Move>
+    void accept(const Solution &, const Move &move) {
+        ++m_iteration;
+        m_tabu_until[attribute(move)] = m_iteration + m_tenure;
+    }
+
+  private:
+    template <typename Move> std::size_t attribute(const Move &move) const {
+        std::size_t a = m_get_attribute(move);
+        assert(a < m_tabu_until.size());
+        return a;
+    }
+
+    std::vector<unsigned long long> m_tabu_until;
+    unsigned long long m_iteration = 0;
+    unsigned m_tenure;
+    GetAttribute m_get_attribute;
+};
+
+/**
+ * @brief make function for tabu_list_attribute
+ *
+ * @tparam GetAttribute
+ * @param attributes_count
+ * @param tenure
+ * @param get_attribute
+ *
+ * @return
+ */
+template <typename GetAttribute>
+tabu_list_attribute<GetAttribute>
+make_tabu_list_attribute(std::size_t attributes_count, unsigned tenure,
+                         GetAttribute get_attribute) {
+    return tabu_list_attribute<GetAttribute>(attributes_count, tenure,
+                                             std::move(get_attribute));
+}
+
 } //!data_structures
 } //!paal
 
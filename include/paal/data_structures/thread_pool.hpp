@@ -14,7 +14,11 @@
 #include <boost/asio/io_service.hpp>
 
 #include <cassert>
+#include <condition_variable>
 #include <cstdlib>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -54,6 +58,106 @@ public:
     }
 };
 
+/**
+ * @brief threadpool whose threads are created once and reused by every call of run,
+ * class uses also current thread!
+ * Useful when many short batches of tasks are run one after another.
+ * run must not be called concurrently.
+ * If a task throws, the remaining tasks are not started, run waits for
+ * the running ones and rethrows the first exception.
+ */
+class persistent_thread_pool {
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_tasks_ready;
+    std::condition_variable m_tasks_done;
+    std::function<void(std::size_t)> m_task;
+    std::size_t m_tasks_count = 0;
+    std::size_t m_next_task = 0;
+    std::size_t m_running_tasks = 0;
+    std::exception_ptr m_exception;
+    bool m_stop = false;
+
+    //runs tasks until there is no task left, the lock is held between tasks
+    void run_tasks(std::unique_lock<std::mutex> &lock) {
+        while (m_next_task < m_tasks_count) {
+            auto task = m_next_task++;
+            ++m_running_tasks;
+            lock.unlock();
+            std::exception_ptr exception;
+            try {
+                m_task(task);
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            lock.lock();
+            --m_running_tasks;
+            if (exception) {
+                if (!m_exception) m_exception = exception;
+                m_next_task = m_tasks_count;
+            }
+        }
+        if (m_running_tasks == 0) {
+            m_tasks_done.notify_all();
+        }
+    }
+
+    void worker() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_tasks_ready.wait(lock, [&]() { return m_stop || m_next_task < m_tasks_count; });
+            if (m_stop) return;
+            run_tasks(lock);
+        }
+    }
+
+public:
+    ///constructor
+    persistent_thread_pool(std::size_t size) {
+        assert(size > 0);
+        m_threads.reserve(size - 1);
+        for (std::size_t i = 0; i + 1 < size; ++i) {
+            m_threads.emplace_back([this]() { worker(); });
+        }
+    }
+
+    persistent_thread_pool(persistent_thread_pool const &) = delete;
+    persistent_thread_pool &operator=(persistent_thread_pool const &) = delete;
+
+    ///destructor
+    ~persistent_thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_tasks_ready.notify_all();
+        for (auto & thread : m_threads) thread.join();
+    }
+
+    ///number of threads, including the current thread
+    std::size_t size() const { return m_threads.size() + 1; }
+
+    ///calls task(i) for every i in [0, tasks_count) (blocking),
+    ///rethrows the first exception thrown by a task
+    template <typename Task>
+    void run(std::size_t tasks_count, Task task) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_task = std::move(task);
+        m_next_task = 0;
+        m_tasks_count = tasks_count;
+        m_tasks_ready.notify_all();
+        run_tasks(lock);
+        m_tasks_done.wait(lock, [&]() { return m_running_tasks == 0; });
+        m_tasks_count = 0;
+        m_next_task = 0;
+        m_task = nullptr;
+        if (m_exception) {
+            auto exception = m_exception;
+            m_exception = nullptr;
+            std::rethrow_exception(exception);
+        }
+    }
+};
 
 }//!paal
 
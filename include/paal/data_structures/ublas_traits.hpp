@@ -51,9 +51,9 @@ struct matrix_type_traits<boost::numeric::ublas::matrix<T>> {
     using matrix_column_major_t = boost::numeric::ublas::matrix<T, boost::numeric::ublas::column_major>;
     using matrix_diagonal_t = boost::numeric::ublas::banded_matrix<T>;
     /// Return the number of rows of the matrix
-    static std::size_t num_rows (boost::numeric::ublas::matrix<T> &m) { return m.size1(); }
+    static std::size_t num_rows (boost::numeric::ublas::matrix<T> const &m) { return m.size1(); }
     /// Return the number of columns of the matrix
-    static std::size_t num_columns (boost::numeric::ublas::matrix<T> &m) { return m.size2(); }
+    static std::size_t num_columns (boost::numeric::ublas::matrix<T> const &m) { return m.size2(); }
 };
 
 } // data_structures
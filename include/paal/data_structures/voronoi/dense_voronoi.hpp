@@ -0,0 +1,312 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file dense_voronoi.hpp
+ * @brief voronoi for metrics indexed by small nonnegative integers
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_DENSE_VORONOI_HPP
+#define PAAL_DENSE_VORONOI_HPP
+
+#include "voronoi_traits.hpp"
+
+#include "paal/data_structures/metric/metric_traits.hpp"
+
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace paal {
+namespace data_structures {
+
+/**
+ * @class dense_voronoi
+ * @brief implementation of the \ref voronoi concept for metrics whose vertices
+ *        are nonnegative integers (e.g. array_metric, graph_metric).
+ *
+ *        The generator of every vertex and the distance to it are kept in flat
+ *        arrays, vertices of the same generator form an intrusive doubly linked
+ *        list (stored in arrays as well). Assigning a vertex to other generator
+ *        does not allocate and copying the voronoi copies a few vectors.
+ *        The generators are kept in a flat vector (in no particular order) and
+ *        marked in a bitmap, so get_generators() returns a vector, not a set.
+ *        The arrays indexed by generators have size equal to the largest generator + 1.
+ *
+ * @tparam Metric
+ */
+template <typename Metric> class dense_voronoi {
+  public:
+    typedef typename metric_traits<Metric>::VertexType VertexType;
+    typedef typename metric_traits<Metric>::DistanceType Dist;
+    typedef std::vector<VertexType> GeneratorsSet;
+    typedef std::vector<VertexType> Vertices;
+
+  private:
+    static constexpr std::size_t no_vertex = std::numeric_limits<std::size_t>::max();
+
+    /// vertices, all other per vertex arrays are indexed by the position in this vector
+    Vertices m_vertices;
+    /// generator of the vertex
+    std::vector<VertexType> m_generator;
+    /// distance from the vertex to its generator
+    std::vector<Dist> m_dist;
+    /// next vertex with the same generator
+    std::vector<std::size_t> m_next;
+    /// previous vertex with the same generator
+    std::vector<std::size_t> m_prev;
+    /// first vertex of the generator, indexed by generators
+    std::vector<std::size_t> m_first;
+    /// generators, in no particular order
+    GeneratorsSet m_generators;
+    /// marks generators, indexed by generators
+    std::vector<bool> m_is_generator;
+
+    const Metric *m_metric;
+    Dist m_cost_of_no_generator;
+
+    class vertices_for_generator_iterator
+        : public boost::iterator_facade<vertices_for_generator_iterator,
+                                        const VertexType,
+                                        boost::forward_traversal_tag> {
+      public:
+        vertices_for_generator_iterator() = default;
+
+        vertices_for_generator_iterator(const dense_voronoi *voronoi,
+                                        std::size_t position)
+            : m_voronoi(voronoi), m_position(position) {}
+
+      private:
+        friend class boost::iterator_core_access;
+
+        const VertexType &dereference() const {
+            return m_voronoi->m_vertices[m_position];
+        }
+
+        void increment() { m_position = m_voronoi->m_next[m_position]; }
+
+        bool equal(const vertices_for_generator_iterator &other) const {
+            return m_position == other.m_position;
+        }
+
+        const dense_voronoi *m_voronoi = nullptr;
+        std::size_t m_position = no_vertex;
+    };
+
+  public:
+    /**
+     * @brief Constructor
+     *
+     * @param generators
+     * @param vertices
+     * @param m
+     * @param costOfNoGenerator
+     */
+    template <typename Generators = GeneratorsSet>
+    dense_voronoi(const Generators &generators, Vertices vertices,
+                  const Metric &m,
+                  Dist costOfNoGenerator = std::numeric_limits<Dist>::max())
+        : m_vertices(std::move(vertices)), m_generator(m_vertices.size()),
+          m_dist(m_vertices.size()), m_next(m_vertices.size(), no_vertex),
+          m_prev(m_vertices.size(), no_vertex), m_metric(&m),
+          m_cost_of_no_generator(costOfNoGenerator) {
+        for (VertexType f : generators) {
+            add_generator(f);
+        }
+    }
+
+    /// returns diff between new cost and old cost
+    Dist add_generator(VertexType f) {
+        assert(f >= 0);
+        assert(!is_generator(f));
+        if (std::size_t(f) >= m_first.size()) {
+            m_first.resize(f + 1, no_vertex);
+            m_is_generator.resize(f + 1, false);
+        }
+        Dist cost = Dist();
+        m_generators.push_back(f);
+        m_is_generator[f] = true;
+
+        if (m_generators.size() == 1) {
+            for (std::size_t p = 0; p < m_vertices.size(); ++p) {
+                m_dist[p] = (*m_metric)(m_vertices[p], f);
+                cost += m_dist[p];
+                link(p, f);
+            }
+            cost = cost - m_cost_of_no_generator;
+        } else {
+            for (std::size_t p = 0; p < m_vertices.size(); ++p) {
+                Dist d = (*m_metric)(m_vertices[p], f);
+                if (d < m_dist[p]) {
+                    cost += d - m_dist[p];
+                    unlink(p);
+                    m_dist[p] = d;
+                    link(p, f);
+                }
+            }
+        }
+        return cost;
+    }
+
+    /// returns diff between new cost and old cost
+    Dist rem_generator(VertexType f) {
+        assert(is_generator(f));
+        Dist cost = Dist();
+        auto pos = std::find(m_generators.begin(), m_generators.end(), f);
+        *pos = m_generators.back();
+        m_generators.pop_back();
+        m_is_generator[f] = false;
+        if (m_generators.empty()) {
+            cost = m_cost_of_no_generator;
+            for (auto d : m_dist) {
+                cost -= d;
+            }
+            m_first[f] = no_vertex;
+        } else {
+            for (auto p = m_first[f]; p != no_vertex;) {
+                // p is moved to the list of other generator
+                auto next = m_next[p];
+                cost += adjust_vertex(p);
+                p = next;
+            }
+            assert(m_first[f] == no_vertex);
+        }
+        return cost;
+    }
+
+    /**
+     * @brief getter for generators
+     *
+     * @return
+     */
+    const GeneratorsSet &get_generators() const { return m_generators; }
+
+    /// checks if the vertex is a generator
+    bool is_generator(VertexType f) const {
+        return std::size_t(f) < m_is_generator.size() && m_is_generator[f];
+    }
+
+    /**
+     * @brief getter for vertices
+     *
+     * @return
+     */
+    const Vertices &get_vertices() const { return m_vertices; }
+
+    /**
+     * @brief getter for metric
+     *
+     * @return
+     */
+    const Metric &get_metric() const { return *m_metric; }
+
+    /**
+     * @brief getter for vertices assigned to specific generator
+     *
+     * @param g
+     */
+    boost::iterator_range<vertices_for_generator_iterator>
+    get_vertices_for_generator(VertexType g) const {
+        auto first = std::size_t(g) < m_first.size() ? m_first[g] : no_vertex;
+        return boost::make_iterator_range(
+            vertices_for_generator_iterator(this, first),
+            vertices_for_generator_iterator(this, no_vertex));
+    }
+
+    ///operator==
+    bool operator==(const dense_voronoi &vor) const {
+        return m_vertices == vor.m_vertices &&
+               m_generators.size() == vor.m_generators.size() &&
+               std::all_of(m_generators.begin(), m_generators.end(),
+                           [&](VertexType f) { return vor.is_generator(f); }) &&
+               (m_generators.empty() || m_generator == vor.m_generator) &&
+               m_cost_of_no_generator == vor.m_cost_of_no_generator &&
+               *m_metric == *vor.m_metric;
+    }
+
+  private:
+    /// assigns vertex on position p to the nearest generator
+    Dist adjust_vertex(std::size_t p) {
+        bool init = true;
+        Dist d = Dist();
+        VertexType f_best = VertexType();
+        for (VertexType f : m_generators) {
+            Dist td = (*m_metric)(m_vertices[p], f);
+            if (init || td < d) {
+                f_best = f;
+                d = td;
+                init = false;
+            }
+        }
+        assert(!init);
+        Dist diff = d - m_dist[p];
+        unlink(p);
+        m_dist[p] = d;
+        link(p, f_best);
+        return diff;
+    }
+
+    void link(std::size_t p, VertexType f) {
+        m_generator[p] = f;
+        m_prev[p] = no_vertex;
+        m_next[p] = m_first[f];
+        if (m_first[f] != no_vertex) {
+            m_prev[m_first[f]] = p;
+        }
+        m_first[f] = p;
+    }
+
+    void unlink(std::size_t p) {
+        auto prev = m_prev[p];
+        auto next = m_next[p];
+        if (prev != no_vertex) {
+            m_next[prev] = next;
+        } else {
+            m_first[m_generator[p]] = next;
+        }
+        if (next != no_vertex) {
+            m_prev[next] = prev;
+        }
+    }
+};
+
+template <typename Metric>
+constexpr std::size_t dense_voronoi<Metric>::no_vertex;
+
+///make for dense_voronoi
+template <typename Metric,
+          typename Generators = typename dense_voronoi<Metric>::GeneratorsSet>
+dense_voronoi<Metric> make_dense_voronoi(
+        const Generators & generators,
+        typename dense_voronoi<Metric>::Vertices vertices,
+        const Metric & metric,
+        typename dense_voronoi<Metric>::Dist costOfNoGenerator =
+            std::numeric_limits<typename dense_voronoi<Metric>::Dist>::max())
+{
+    return dense_voronoi<Metric>(generators, std::move(vertices), metric, costOfNoGenerator);
+}
+
+/**
+ * @brief specialization of voronoi_traits
+ *
+ * @tparam Metric
+ */
+template <typename Metric>
+struct voronoi_traits<dense_voronoi<Metric>> : public _voronoi_traits<
+    dense_voronoi<Metric>, typename metric_traits<Metric>::VertexType> {};
+
+} //!data_structures
+} //!paal
+
+#endif // PAAL_DENSE_VORONOI_HPP
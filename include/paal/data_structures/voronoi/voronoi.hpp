@@ -180,6 +180,13 @@ public:
      */
     const Vertices &get_vertices() const { return m_vertices; }
 
+    /**
+     * @brief getter for metric
+     *
+     * @return
+     */
+    const Metric &get_metric() const { return m_metric; }
+
     /**
      * @brief getter for vertices assigned to specific generator
      *
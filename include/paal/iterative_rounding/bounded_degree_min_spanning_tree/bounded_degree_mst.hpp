@@ -17,6 +17,7 @@
 
 
 #include "paal/iterative_rounding/bounded_degree_min_spanning_tree/bounded_degree_mst_oracle.hpp"
+#include "paal/iterative_rounding/check_violation_functor.hpp"
 #include "paal/iterative_rounding/ir_components.hpp"
 #include "paal/iterative_rounding/iterative_rounding.hpp"
 #include "paal/lp/lp_row_generation.hpp"
@@ -102,7 +103,7 @@ class bounded_degree_mst {
     auto get_find_violation(LP & lp) {
         using candidate = bdmst_violation_checker::Candidate;
         return m_oracle([&](){return m_violation_checker.get_violation_candidates(*this, lp);},
-                        [&](candidate c){return m_violation_checker.check_violation(c, *this);},
+                        make_check_violation_functor(m_violation_checker, *this),
                         [&](candidate c){return m_violation_checker.add_violated_constraint(c, *this, lp);});
     }
 
@@ -500,7 +501,7 @@ template <typename Init = bdmst_init,
           typename RelaxContition = bdmst_relax_condition,
           typename SetSolution = bdmst_set_solution,
           typename SolveLPToExtremePoint = ir::row_generation_solve_lp<>,
-          typename ResolveLpToExtremePoint = ir::row_generation_solve_lp<>>
+          typename ResolveLpToExtremePoint = ir::row_generation_resolve_lp>
 using bdmst_ir_components =
     IRcomponents<Init, RoundCondition, RelaxContition, SetSolution,
                  SolveLPToExtremePoint, ResolveLpToExtremePoint>;
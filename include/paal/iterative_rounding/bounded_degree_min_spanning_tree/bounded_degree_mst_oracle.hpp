@@ -32,9 +32,9 @@ namespace ir {
  *      in the bounded degree minimum spanning tree problem.
  */
 class bdmst_violation_checker {
-    using AuxEdge = min_cut_finder::Edge;
     using AuxVertex = min_cut_finder::Vertex;
-    using AuxEdgeList = std::vector<AuxEdge>;
+    /// indices of the edges in m_min_cut, they are preserved by copying
+    using AuxEdgeList = std::vector<std::size_t>;
     using Violation = boost::optional<double>;
 
   public:
@@ -121,11 +121,10 @@ class bdmst_violation_checker {
 
         for (auto v : boost::as_array(vertices(g))) {
             auto aux_v = get(index, v);
-            m_src_to_v[aux_v] = m_min_cut
-                .add_edge_to_graph(m_src, aux_v, degree_of(problem, v, lp) / 2)
-                .first;
-            m_v_to_trg[aux_v] =
-                m_min_cut.add_edge_to_graph(aux_v, m_trg, 1).first;
+            m_src_to_v[aux_v] = m_min_cut.edges_count();
+            m_min_cut.add_edge_to_graph(m_src, aux_v, degree_of(problem, v, lp) / 2);
+            m_v_to_trg[aux_v] = m_min_cut.edges_count();
+            m_min_cut.add_edge_to_graph(aux_v, m_trg, 1);
         }
     }
 
@@ -173,21 +172,24 @@ class bdmst_violation_checker {
      * @return violation of the found set
      */
     double find_violation(AuxVertex src, AuxVertex trg) {
-        double orig_cap = m_min_cut.get_capacity(m_src_to_v[src]);
+        auto src_to_src = m_min_cut.get_edge(m_src_to_v[src]);
+        auto src_to_trg = m_min_cut.get_edge(m_v_to_trg[src]);
+        auto trg_to_trg = m_min_cut.get_edge(m_v_to_trg[trg]);
+        double orig_cap = m_min_cut.get_capacity(src_to_src);
 
-        m_min_cut.set_capacity(m_src_to_v[src], m_vertices_num);
+        m_min_cut.set_capacity(src_to_src, m_vertices_num);
         // capacity of m_src_to_v[trg] does not change
-        m_min_cut.set_capacity(m_v_to_trg[src], 0);
-        m_min_cut.set_capacity(m_v_to_trg[trg], m_vertices_num);
+        m_min_cut.set_capacity(src_to_trg, 0);
+        m_min_cut.set_capacity(trg_to_trg, m_vertices_num);
 
         double min_cut_weight = m_min_cut.find_min_cut(m_src, m_trg);
         double violation = m_vertices_num - 1 - min_cut_weight;
 
         // reset the original values for the capacities
-        m_min_cut.set_capacity(m_src_to_v[src], orig_cap);
+        m_min_cut.set_capacity(src_to_src, orig_cap);
         // capacity of m_src_to_v[trg] does not change
-        m_min_cut.set_capacity(m_v_to_trg[src], 1);
-        m_min_cut.set_capacity(m_v_to_trg[trg], 1);
+        m_min_cut.set_capacity(src_to_trg, 1);
+        m_min_cut.set_capacity(trg_to_trg, 1);
 
         return violation;
     }
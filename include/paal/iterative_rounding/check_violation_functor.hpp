@@ -0,0 +1,93 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file check_violation_functor.hpp
+ * @brief HowViolated functor for the separation oracles, which can be cloned
+ * for parallel separation oracles
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_CHECK_VIOLATION_FUNCTOR_HPP
+#define PAAL_CHECK_VIOLATION_FUNCTOR_HPP
+
+#include <memory>
+
+namespace paal {
+namespace ir {
+
+/**
+ * @brief Functor calling checker.check_violation(candidate, problem).
+ * Violation checkers keep the auxiliary graph used for finding cuts, so
+ * one checker can not be used by many threads. clone() returns the functor
+ * using a copy of the checker, it is used by the parallel separation oracles.
+ *
+ * @tparam Checker
+ * @tparam Problem
+ */
+template <typename Checker, typename Problem> class check_violation_functor {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param checker
+     * @param problem
+     */
+    check_violation_functor(Checker &checker, const Problem &problem)
+        : m_checker(&checker), m_problem(&problem) {}
+
+    /**
+     * @brief operator()
+     *
+     * @tparam Candidate
+     * @param candidate
+     *
+     * @return violation of the candidate
+     */
+    template <typename Candidate> auto operator()(Candidate candidate) const {
+        return m_checker->check_violation(candidate, *m_problem);
+    }
+
+    /**
+     * @brief functor using its own copy of the checker
+     *
+     * @return
+     */
+    check_violation_functor clone() const {
+        check_violation_functor ret(*this);
+        ret.m_owned = std::make_shared<Checker>(*m_checker);
+        ret.m_checker = ret.m_owned.get();
+        return ret;
+    }
+
+  private:
+    Checker *m_checker;
+    std::shared_ptr<Checker> m_owned;
+    const Problem *m_problem;
+};
+
+/**
+ * @brief make for check_violation_functor
+ *
+ * @tparam Checker
+ * @tparam Problem
+ * @param checker
+ * @param problem
+ *
+ * @return
+ */
+template <typename Checker, typename Problem>
+check_violation_functor<Checker, Problem>
+make_check_violation_functor(Checker &checker, const Problem &problem) {
+    return check_violation_functor<Checker, Problem>(checker, problem);
+}
+
+} //! ir
+} //! paal
+
+#endif // PAAL_CHECK_VIOLATION_FUNCTOR_HPP
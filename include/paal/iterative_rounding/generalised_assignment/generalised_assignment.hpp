@@ -87,6 +87,7 @@ class ga_init {
         add_variables(problem, lp);
         add_constraints_for_jobs(problem, lp);
         add_constraints_for_machines(problem, lp);
+        lp.load_staged();
     }
 
   private:
@@ -103,10 +104,10 @@ class ga_init {
             for (auto &&m : problem.get_machines()) {
                 if (problem.get_proceeding_time()(j, m) <=
                     problem.get_machine_available_time()(m)) {
-                    col_idx.push_back(lp.add_column(problem.get_cost()(j, m)));
+                    col_idx.push_back(lp.stage_column(problem.get_cost()(j, m)));
                 } else {
                     col_idx.push_back(
-                        lp.add_column(problem.get_cost()(j, m), 0, 0));
+                        lp.stage_column(problem.get_cost()(j, m), 0, 0));
                 }
             }
         }
@@ -121,7 +122,7 @@ class ga_init {
             for (auto m_idx : irange(problem.get_machines_cnt())) {
                 expr += col_idx[problem.idx(j_idx, m_idx)];
             }
-            lp.add_row(std::move(expr) == 1.0);
+            lp.stage_row(std::move(expr) == 1.0);
         }
     }
 
@@ -138,7 +139,7 @@ class ga_init {
                 auto x = col_idx[problem.idx(j.index(), m.index())];
                 expr += x * t;
             }
-            auto row = lp.add_row(std::move(expr) <= T);
+            auto row = lp.stage_row(std::move(expr) <= T);
             problem.get_machine_rows().insert(row);
         }
     }
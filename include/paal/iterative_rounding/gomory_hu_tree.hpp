@@ -0,0 +1,88 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file gomory_hu_tree.hpp
+ * @brief equivalent flow tree (Gusfield's variant of Gomory-Hu tree)
+ * of an undirected graph
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_GOMORY_HU_TREE_HPP
+#define PAAL_GOMORY_HU_TREE_HPP
+
+#include "paal/iterative_rounding/min_cut.hpp"
+
+#include <cassert>
+#include <limits>
+#include <vector>
+
+namespace paal {
+namespace ir {
+
+/**
+ * @class gomory_hu_tree
+ * @brief Tree on the vertices of an undirected graph, in which
+ *  the minimum cut value between any two vertices is the minimum
+ *  weight on the tree path between them.
+ *  It is built by Gusfield's algorithm, using vertices_num - 1 max flows.
+ *  The tree gives only the values of the cuts (it is an equivalent flow tree),
+ *  the cuts themselves have to be found by min_cut_finder.
+ */
+class gomory_hu_tree {
+public:
+    using Vertex = min_cut_finder::Vertex;
+
+    /**
+     * Builds the tree for the vertices 0, ..., vertices_num - 1 of the graph
+     * of min_cut. Every edge of the graph must have the same capacity
+     * as its reverse edge.
+     */
+    void build(min_cut_finder &min_cut, int vertices_num) {
+        m_parent.assign(vertices_num, 0);
+        m_weight.assign(vertices_num, std::numeric_limits<double>::max());
+        m_depth.assign(vertices_num, 0);
+        for (int s = 1; s < vertices_num; ++s) {
+            Vertex t = m_parent[s];
+            m_weight[s] = min_cut.find_min_cut(s, t);
+            for (int i = s + 1; i < vertices_num; ++i) {
+                if (m_parent[i] == t && min_cut.is_in_source_set(i)) {
+                    m_parent[i] = s;
+                }
+            }
+            // parents precede their children
+            m_depth[s] = m_depth[t] + 1;
+        }
+    }
+
+    /**
+     * Returns the minimum cut value between \c u and \c v.
+     */
+    double min_cut_value(Vertex u, Vertex v) const {
+        assert(u != v);
+        double ret = std::numeric_limits<double>::max();
+        while (u != v) {
+            if (m_depth[u] < m_depth[v]) {
+                std::swap(u, v);
+            }
+            ret = std::min(ret, m_weight[u]);
+            u = m_parent[u];
+        }
+        return ret;
+    }
+
+private:
+    std::vector<Vertex> m_parent;
+    /// weight of the edge to the parent
+    std::vector<double> m_weight;
+    std::vector<int> m_depth;
+};
+
+} //! ir
+} //! paal
+#endif // PAAL_GOMORY_HU_TREE_HPP
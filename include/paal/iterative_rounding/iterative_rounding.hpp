@@ -18,6 +18,7 @@
 
 #include "paal/iterative_rounding/ir_components.hpp"
 #include "paal/lp/glp.hpp"
+#include "paal/lp/solve_statistics.hpp"
 #include "paal/utils/floating.hpp"
 #include "paal/utils/type_functions.hpp"
 #include "paal/utils/irange.hpp"
@@ -26,6 +27,7 @@
 
 #include <cstdlib>
 #include <unordered_map>
+#include <vector>
 
 namespace paal {
 namespace ir {
@@ -51,6 +53,67 @@ struct trivial_visitor {
      */
     template <typename Problem, typename LP>
     void relax_row(Problem &problem, LP &lp, lp::row_id row) {}
+
+    /**
+     * @brief Method called after (re)solving the LP with the statistics
+     * of the simplex runs of this (re)solve.
+     */
+    template <typename Problem, typename LP>
+    void solve_lp_statistics(Problem &problem, LP &lp,
+                             const lp::solve_statistics &statistics) {}
+};
+
+/**
+ * @brief statistics of one iteration of Iterative Rounding
+ */
+struct ir_iteration_statistics {
+    /// simplex runs of the (re)solve ending the iteration
+    lp::solve_statistics lp;
+    /// columns rounded before the resolve
+    int rounded;
+    /// rows relaxed before the resolve
+    int relaxed;
+};
+
+/**
+ * @brief Visitor recording the statistics of the Iterative Rounding
+ * iterations. The first entry describes the initial solve.
+ */
+class statistics_visitor : public trivial_visitor {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param iterations the statistics are appended here
+     */
+    statistics_visitor(std::vector<ir_iteration_statistics> &iterations)
+        : m_iterations(&iterations) {}
+
+    /// counts the rounded column
+    template <typename Problem, typename LP>
+    void round_col(Problem &, LP &, lp::col_id, double) {
+        ++m_rounded;
+    }
+
+    /// counts the relaxed row
+    template <typename Problem, typename LP>
+    void relax_row(Problem &, LP &, lp::row_id) {
+        ++m_relaxed;
+    }
+
+    /// records the iteration
+    template <typename Problem, typename LP>
+    void solve_lp_statistics(Problem &, LP &,
+                             const lp::solve_statistics &statistics) {
+        m_iterations->push_back(
+            ir_iteration_statistics{ statistics, m_rounded, m_relaxed });
+        m_rounded = m_relaxed = 0;
+    }
+
+  private:
+    std::vector<ir_iteration_statistics> *m_iterations;
+    int m_rounded = 0;
+    int m_relaxed = 0;
 };
 
 ///default solve lp for row_generation,
@@ -74,6 +137,29 @@ public:
     }
 };
 
+///solve lp for row_generation in the IR resolve,
+///at first call PRIMAL starting from the basis of the previous IR iteration
+///(rounding and relaxing keep the previous solution feasible),
+///and DUAL on the next calls
+template <typename Problem, typename LP>
+class warm_solve_lp_in_row_generation {
+    bool m_first;
+    LP & m_lp;
+public:
+    ///constructor
+    warm_solve_lp_in_row_generation(Problem &, LP & lp) : m_first(true), m_lp(lp) {}
+
+    ///operator()
+    lp::problem_type operator()()
+    {
+        if (m_first) {
+            m_first = false;
+            return m_lp.resolve_simplex(lp::PRIMAL);
+        }
+        return m_lp.resolve_simplex(lp::DUAL);
+    }
+};
+
 /// default row_generation for lp,
 /// one can customize LP solving, by setting SolveLP
 template <template <class, class> class SolveLP = default_solve_lp_in_row_generation>
@@ -85,10 +171,42 @@ template <class Problem, class LP>
     }
 };
 
+/// row_generation for the IR resolve, keeping the LP basis between iterations
+using row_generation_resolve_lp = row_generation_solve_lp<warm_solve_lp_in_row_generation>;
+
 
 
 namespace detail {
 
+/// LP with get_solve_statistics: the statistics of its simplex runs
+template <typename LP>
+auto get_solve_statistics(const LP &lp, int)
+    -> decltype(lp::solve_statistics(lp.get_solve_statistics())) {
+    return lp.get_solve_statistics();
+}
+
+/// LP without get_solve_statistics: empty statistics
+template <typename LP>
+lp::solve_statistics get_solve_statistics(const LP &, long) {
+    return lp::solve_statistics{};
+}
+
+/// visitor with solve_lp_statistics and LP with get_solve_statistics
+template <typename Visitor, typename Problem, typename LP>
+auto visit_solve_lp_statistics(Visitor &visitor, Problem &problem, LP &lp,
+                               const lp::solve_statistics &before, int)
+    -> decltype(visitor.solve_lp_statistics(problem, lp,
+                                            lp.get_solve_statistics() -
+                                                before)) {
+    return visitor.solve_lp_statistics(problem, lp,
+                                       lp.get_solve_statistics() - before);
+}
+
+/// otherwise nothing is done
+template <typename Visitor, typename Problem, typename LP>
+void visit_solve_lp_statistics(Visitor &, Problem &, LP &,
+                               const lp::solve_statistics &, long) {}
+
     /**
      * @brief This class solves an iterative rounding problem.
  *
@@ -130,9 +248,12 @@ class iterative_rounding  {
      * @return LP solution status
      */
     lp::problem_type solve_lp() {
+        auto before = detail::get_solve_statistics(m_lp, 0);
         auto prob_type = call<SolveLP>(m_problem, m_lp);
         assert(prob_type != lp::UNDEFINED);
         m_visitor.solve_lp(m_problem, m_lp);
+        detail::visit_solve_lp_statistics(m_visitor, m_problem, m_lp, before,
+                                          0);
         return prob_type;
     }
 
@@ -142,9 +263,12 @@ class iterative_rounding  {
      * @return LP solution status
      */
     lp::problem_type resolve_lp() {
+        auto before = detail::get_solve_statistics(m_lp, 0);
         auto prob_type = call<ResolveLP>(m_problem, m_lp);
         assert(prob_type != lp::UNDEFINED);
         m_visitor.solve_lp(m_problem, m_lp);
+        detail::visit_solve_lp_statistics(m_visitor, m_problem, m_lp, before,
+                                          0);
         return prob_type;
     }
 
@@ -169,27 +293,28 @@ class iterative_rounding  {
      * @return true iff at least one column was rounded
      */
     bool round() {
-        int deleted(0);
-        auto &&cols = m_lp.get_columns();
-        auto cbegin = std::begin(cols);
-        auto cend = std::end(cols);
+        // the rounded columns are removed from the LP in one call,
+        // after all the conditions were checked, so that the conditions
+        // and the visitor see the same LP
+        std::vector<lp::col_id> deleted;
+        std::vector<double> values;
 
-        while (cbegin != cend) {
-            lp::col_id col = *cbegin;
+        for (lp::col_id col : m_lp.get_columns()) {
             auto do_round = call<RoundCondition>(m_problem, m_lp, col);
             if (do_round) {
-                ++deleted;
+                deleted.push_back(col);
+                values.push_back(*do_round);
                 m_rounded.insert(std::make_pair(col,
                     std::make_pair(*do_round, m_lp.get_col_coef(col))));
                 m_visitor.round_col(m_problem, m_lp, col, *do_round);
-                cbegin = delete_column(cbegin, *do_round);
-            }
-            else {
-                ++cbegin;
             }
         }
+        for (std::size_t i = 0; i < deleted.size(); ++i) {
+            adjust_row_bounds(deleted[i], values[i]);
+        }
+        m_lp.delete_cols(deleted);
 
-        return deleted > 0;
+        return !deleted.empty();
     }
 
     /**
@@ -198,26 +323,21 @@ class iterative_rounding  {
      * @return true iff at least one row was relaxed
      */
     bool relax() {
-        int deleted(0);
-        auto &&rows = m_lp.get_rows();
-        auto rbegin = std::begin(rows);
-        auto rend = std::end(rows);
+        // the relaxed rows are removed from the LP in one call
+        std::vector<lp::row_id> deleted;
 
-        while (rbegin != rend) {
-            lp::row_id row = *rbegin;
+        for (lp::row_id row : m_lp.get_rows()) {
             if (call<RelaxCondition>(m_problem, m_lp, row)) {
-                ++deleted;
+                deleted.push_back(row);
                 m_visitor.relax_row(m_problem, m_lp, row);
-                rbegin = m_lp.delete_row(rbegin);
-                if (call<RelaxationsLimit>(deleted)) {
+                if (call<RelaxationsLimit>(int(deleted.size()))) {
                     break;
                 }
-            } else {
-                ++rbegin;
             }
         }
+        m_lp.delete_rows(deleted);
 
-        return deleted > 0;
+        return !deleted.empty();
     }
 
     /**
@@ -260,10 +380,9 @@ class iterative_rounding  {
             std::forward<Args>(args)...);
     }
 
-    /// Deletes a column from the LP and adjusts the row bounds.
-    typename LP::ColIter
-    delete_column(typename LP::ColIter col_iter, double value) {
-        auto column = m_lp.get_rows_in_column(*col_iter);
+    /// Adjusts the row bounds to the rounded value of the column.
+    void adjust_row_bounds(lp::col_id col, double value) {
+        auto column = m_lp.get_rows_in_column(col);
         lp::row_id row;
         double coef;
         for (auto const &c : column) {
@@ -274,8 +393,7 @@ class iterative_rounding  {
             m_lp.set_row_upper_bound(row, ub - diff);
             m_lp.set_row_lower_bound(row, lb - diff);
         }
-        return m_lp.delete_col(col_iter);
-    };
+    }
 
     LP m_lp;
     IRcomponents m_ir_components;
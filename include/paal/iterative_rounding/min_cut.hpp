@@ -17,8 +17,11 @@
 
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/boykov_kolmogorov_max_flow.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <numeric>
+#include <utility>
+#include <vector>
 
 namespace paal {
 namespace ir {
@@ -40,11 +43,43 @@ public:
           m_rev(get(boost::edge_reverse, m_graph)),
           m_colors(get(boost::vertex_color, m_graph)) {}
 
+    /**
+     * Copy constructor, the graph is rebuilt because edge descriptors
+     * point to the edge properties of the graph.
+     */
+    min_cut_finder(const min_cut_finder &other) : min_cut_finder() {
+        *this = other;
+    }
+
+    /**
+     * Assignment operator, the graph is rebuilt because edge descriptors
+     * point to the edge properties of the graph.
+     * Edges get the same indices as in the other graph.
+     */
+    min_cut_finder &operator=(const min_cut_finder &other) {
+        if (this == &other) return *this;
+        init(num_vertices(other.m_graph));
+        for (auto const &e : other.m_edges) {
+            add_edge_to_graph(source(e.first, other.m_graph),
+                              target(e.first, other.m_graph),
+                              other.get_capacity(e.first),
+                              other.get_capacity(e.second));
+        }
+        m_colors = get(boost::vertex_color, m_graph);
+        for (auto v : boost::make_iterator_range(vertices(m_graph))) {
+            put(m_colors, v, get(other.m_colors, v));
+        }
+        m_src_color = other.m_src_color;
+        m_last_cut = other.m_last_cut;
+        return *this;
+    }
+
     /**
      * (Re)Initializes the graph.
      */
     void init(int vertices_num) {
         m_graph.clear();
+        m_edges.clear();
         for (int i = 0; i < vertices_num; ++i) {
             add_vertex_to_graph();
         }
@@ -81,6 +116,7 @@ public:
         put(m_rev, e, e_rev);
         put(m_rev, e_rev, e);
 
+        m_edges.emplace_back(e, e_rev);
         return std::make_pair(e, e_rev);
     }
 
@@ -127,6 +163,17 @@ public:
      */
     std::pair<Vertex, Vertex> get_last_cut() const { return m_last_cut; }
 
+    /**
+     * Returns the number of edges added by add_edge_to_graph.
+     */
+    std::size_t edges_count() const { return m_edges.size(); }
+
+    /**
+     * Returns the edge added by the i-th call of add_edge_to_graph,
+     * indices are preserved by copying.
+     */
+    Edge get_edge(std::size_t i) const { return m_edges[i].first; }
+
     /**
      * Returns the capacity of a given edge.
      */
@@ -161,6 +208,8 @@ private:
     using VertexColors = boost::property_map<Graph, boost::vertex_color_t>::type;
 
     Graph m_graph;
+    /// edges and reverse edges in the order of adding
+    std::vector<std::pair<Edge, Edge>> m_edges;
 
     EdgeCapacity m_cap;
     EdgeReverse m_rev;
@@ -17,6 +17,7 @@
 #define PAAL_STEINER_NETWORK_HPP
 
 
+#include "paal/iterative_rounding/check_violation_functor.hpp"
 #include "paal/iterative_rounding/ir_components.hpp"
 #include "paal/iterative_rounding/iterative_rounding.hpp"
 #include "paal/iterative_rounding/steiner_network/prune_restrictions_to_tree.hpp"
@@ -48,10 +49,13 @@ const double steiner_network_compare_traits::EPSILON = 1e-10;
  * @tparam Restrictions connectivity restrictions for vertex pairs
  * @tparam CostMap map of edge costs
  * @tparam ResultNetworkOutputIterator
+ * @tparam Oracle separation oracle
+ * @tparam Separation per_pair_separation or cut_tree_separation
  */
 template <typename Graph, typename Restrictions, typename CostMap,
           typename VertexIndex, typename ResultNetworkOutputIterator,
-          typename Oracle = paal::lp::random_violated_separation_oracle>
+          typename Oracle = paal::lp::random_violated_separation_oracle,
+          typename Separation = per_pair_separation>
 class steiner_network {
     using edge = typename boost::graph_traits<Graph>::edge_descriptor;
     using vertex = typename boost::graph_traits<Graph>::vertex_descriptor;
@@ -63,7 +67,9 @@ class steiner_network {
     using compare = utils::compare<double>;
     using error_message = boost::optional<std::string>;
 
-    steiner_network_violation_checker m_violation_checker;
+    using violation_checker = steiner_network_violation_checker<Separation>;
+
+    violation_checker m_violation_checker;
     const Graph &m_g;
     const Restrictions &m_restrictions;
     CostMap m_cost_map;
@@ -94,7 +100,7 @@ public:
      * Checks if the connectivity restrictions can be fulfilled.
      */
     error_message check_input_validity() {
-        steiner_network_violation_checker checker;
+        violation_checker checker;
         if (!checker.check_if_solution_exists(*this)) {
             return error_message{ "A Steiner network satisfying the "
                                  "restrictions does not exist." };
@@ -113,9 +119,9 @@ public:
      */
     template <typename LP>
     auto get_find_violation(LP & lp) {
-        using candidate = steiner_network_violation_checker::Candidate;
+        using candidate = typename violation_checker::Candidate;
         return m_oracle([&](){return m_violation_checker.get_violation_candidates(*this, lp);},
-                        [&](candidate c){return m_violation_checker.check_violation(c, *this);},
+                        make_check_violation_functor(m_violation_checker, *this),
                         [&](candidate c){return m_violation_checker.add_violated_constraint(c, *this, lp);});
     }
 
@@ -225,15 +231,16 @@ namespace detail {
  * @return steiner_network object
  */
 template <typename Oracle = lp::random_violated_separation_oracle,
+    typename Separation = per_pair_separation,
     typename Graph, typename Restrictions, typename CostMap,
     typename VertexIndex, typename ResultNetworkOutputIterator>
-steiner_network<Graph, Restrictions, CostMap, VertexIndex, ResultNetworkOutputIterator, Oracle>
+steiner_network<Graph, Restrictions, CostMap, VertexIndex, ResultNetworkOutputIterator, Oracle, Separation>
 make_steiner_network(const Graph & g, const Restrictions & restrictions,
                     CostMap cost_map, VertexIndex vertex_index,
                     ResultNetworkOutputIterator result_network,
                     Oracle oracle = Oracle{}) {
     return steiner_network<Graph, Restrictions, CostMap, VertexIndex,
-                ResultNetworkOutputIterator, Oracle>(
+                ResultNetworkOutputIterator, Oracle, Separation>(
                                     g, restrictions, cost_map, vertex_index, result_network, oracle);
 }
 } // detail
@@ -245,6 +252,7 @@ make_steiner_network(const Graph & g, const Restrictions & restrictions,
  * optimal solution cost.
  *
  * @tparam Oracle
+ * @tparam Separation
  * @tparam Graph
  * @tparam Restrictions
  * @tparam ResultNetworkOutputIterator
@@ -260,6 +268,7 @@ make_steiner_network(const Graph & g, const Restrictions & restrictions,
  * @return steiner_network object
  */
 template <typename Oracle = lp::random_violated_separation_oracle,
+    typename Separation = per_pair_separation,
     typename Graph, typename Restrictions, typename ResultNetworkOutputIterator,
     typename P, typename T, typename R>
 auto
@@ -270,8 +279,8 @@ make_steiner_network(const Graph & g, const Restrictions & restrictions,
        steiner_network<Graph, Restrictions,
             decltype(choose_const_pmap(get_param(params, boost::edge_weight), g, boost::edge_weight)),
             decltype(choose_const_pmap(get_param(params, boost::vertex_index), g, boost::vertex_index)),
-            ResultNetworkOutputIterator, Oracle> {
-    return detail::make_steiner_network(g, restrictions,
+            ResultNetworkOutputIterator, Oracle, Separation> {
+    return detail::make_steiner_network<Oracle, Separation>(g, restrictions,
                 choose_const_pmap(get_param(params, boost::edge_weight), g, boost::edge_weight),
                 choose_const_pmap(get_param(params, boost::vertex_index), g, boost::vertex_index),
                 result_network, oracle);
@@ -284,6 +293,7 @@ make_steiner_network(const Graph & g, const Restrictions & restrictions,
  * optimal solution cost.
  *
  * @tparam Oracle
+ * @tparam Separation
  * @tparam Graph
  * @tparam Restrictions
  * @tparam ResultNetworkOutputIterator
@@ -295,12 +305,13 @@ make_steiner_network(const Graph & g, const Restrictions & restrictions,
  * @return steiner_network object
  */
 template <typename Oracle = lp::random_violated_separation_oracle,
+    typename Separation = per_pair_separation,
     typename Graph, typename Restrictions, typename ResultNetworkOutputIterator>
 auto
 make_steiner_network(const Graph & g, const Restrictions & restrictions,
                     ResultNetworkOutputIterator result_network, Oracle oracle = Oracle()) ->
-        decltype(make_steiner_network(g, restrictions, boost::no_named_parameters(), result_network, oracle)) {
-    return make_steiner_network(g, restrictions, boost::no_named_parameters(), result_network, oracle);
+        decltype(make_steiner_network<Oracle, Separation>(g, restrictions, boost::no_named_parameters(), result_network, oracle)) {
+    return make_steiner_network<Oracle, Separation>(g, restrictions, boost::no_named_parameters(), result_network, oracle);
 }
 
 /**
@@ -415,6 +426,7 @@ namespace detail {
 * version.
  *
  * @tparam Oracle
+ * @tparam Separation
  * @tparam Graph
  * @tparam Restrictions
  * @tparam CostMap
@@ -433,7 +445,8 @@ namespace detail {
  *
  * @return solution status
  */
-template <typename Oracle = lp::random_violated_separation_oracle, typename Graph,
+template <typename Oracle = lp::random_violated_separation_oracle,
+          typename Separation = per_pair_separation, typename Graph,
           typename Restrictions, typename CostMap, typename VertexIndex,
           typename ResultNetworkOutputIterator,
           typename IRcomponents = steiner_network_ir_components<>,
@@ -447,7 +460,8 @@ IRResult steiner_network_iterative_rounding(
         IRcomponents components = IRcomponents(),
         Oracle oracle = Oracle(),
         Visitor visitor = Visitor()) {
-    auto steiner = make_steiner_network(g, restrictions, cost, vertex_index, result, oracle);
+    auto steiner = make_steiner_network<Oracle, Separation>(
+        g, restrictions, cost, vertex_index, result, oracle);
     return solve_iterative_rounding(steiner, std::move(components), std::move(visitor));
 }
 } // detail
@@ -457,6 +471,7 @@ IRResult steiner_network_iterative_rounding(
 * version.
  *
  * @tparam Oracle
+ * @tparam Separation
  * @tparam Graph
  * @tparam Restrictions
  * @tparam ResultNetworkOutputIterator
@@ -475,7 +490,8 @@ IRResult steiner_network_iterative_rounding(
  *
  * @return solution status
  */
-template <typename Oracle = lp::random_violated_separation_oracle, typename Graph,
+template <typename Oracle = lp::random_violated_separation_oracle,
+          typename Separation = per_pair_separation, typename Graph,
           typename Restrictions, typename ResultNetworkOutputIterator,
           typename IRcomponents = steiner_network_ir_components<>,
           typename Visitor = trivial_visitor, typename P, typename T,
@@ -486,7 +502,7 @@ IRResult steiner_network_iterative_rounding(
     ResultNetworkOutputIterator result,
     IRcomponents components = IRcomponents(), Oracle oracle = Oracle(),
     Visitor visitor = Visitor()) {
-    return detail::steiner_network_iterative_rounding(
+    return detail::steiner_network_iterative_rounding<Oracle, Separation>(
         g, restrictions,
         choose_const_pmap(get_param(params, boost::edge_weight), g,
                           boost::edge_weight),
@@ -501,6 +517,7 @@ IRResult steiner_network_iterative_rounding(
 * default parameters.
  *
  * @tparam Oracle
+ * @tparam Separation
  * @tparam Graph
  * @tparam Restrictions
  * @tparam ResultNetworkOutputIterator
@@ -515,7 +532,8 @@ IRResult steiner_network_iterative_rounding(
  *
  * @return solution status
  */
-template <typename Oracle = lp::random_violated_separation_oracle, typename Graph,
+template <typename Oracle = lp::random_violated_separation_oracle,
+          typename Separation = per_pair_separation, typename Graph,
           typename Restrictions, typename ResultNetworkOutputIterator,
           typename IRcomponents = steiner_network_ir_components<>,
           typename Visitor = trivial_visitor>
@@ -526,7 +544,7 @@ IRResult steiner_network_iterative_rounding(const Graph &g,
                                                 IRcomponents(),
                                             Oracle oracle = Oracle(),
                                             Visitor visitor = Visitor()) {
-    return steiner_network_iterative_rounding(
+    return steiner_network_iterative_rounding<Oracle, Separation>(
         g, restrictions, boost::no_named_parameters(), std::move(result),
         std::move(components), std::move(oracle), std::move(visitor));
 }
@@ -16,6 +16,7 @@
 #ifndef PAAL_STEINER_NETWORK_ORACLE_HPP
 #define PAAL_STEINER_NETWORK_ORACLE_HPP
 
+#include "paal/iterative_rounding/gomory_hu_tree.hpp"
 #include "paal/iterative_rounding/min_cut.hpp"
 
 #include <boost/range/as_array.hpp>
@@ -23,11 +24,23 @@
 namespace paal {
 namespace ir {
 
+/// Separation computing one max flow for every checked candidate.
+struct per_pair_separation {};
+
+/**
+ * Separation building a gomory_hu_tree (vertices number - 1 max flows)
+ * for every LP solution and reading the min cuts of all candidates from it.
+ */
+struct cut_tree_separation {};
+
 /**
  * @class steiner_network_violation_checker
  * @brief Violations checker for the separation oracle
  *      in the steiner network problem.
+ *
+ * @tparam Separation per_pair_separation or cut_tree_separation
  */
+template <typename Separation = per_pair_separation>
 class steiner_network_violation_checker {
     using AuxVertex = min_cut_finder::Vertex;
     using Violation = double;
@@ -49,6 +62,7 @@ class steiner_network_violation_checker {
             auto v = get(index, target(e, g));
             m_min_cut.add_edge_to_graph(u, v, 1, 1);
         }
+        prepare(num_vertices(g), Separation{});
 
         for (auto res : problem.get_restrictions_vec()) {
             if (check_violation(res, problem)) {
@@ -77,7 +91,8 @@ class steiner_network_violation_checker {
     template <typename Problem>
     Violation check_violation(Candidate candidate, const Problem &problem) {
         double violation =
-            find_violation(candidate.first, candidate.second, problem);
+            problem.get_max_restriction(candidate.first, candidate.second) -
+            min_cut_value(candidate.first, candidate.second, Separation{});
         if (problem.get_compare().g(violation, 0)) {
             return violation;
         } else {
@@ -155,6 +170,25 @@ class steiner_network_violation_checker {
             auto v = get(index, target(e, g));
             m_min_cut.add_edge_to_graph(u, v, 1, 1);
         }
+        prepare(num_vertices(g), Separation{});
+    }
+
+    /// nothing to prepare, cuts are computed for every candidate
+    void prepare(int, per_pair_separation) {}
+
+    /// builds the cut tree of the auxiliary graph
+    void prepare(int vertices_num, cut_tree_separation) {
+        m_cut_tree.build(m_min_cut, vertices_num);
+    }
+
+    /// computes the min cut value between the vertices
+    double min_cut_value(AuxVertex src, AuxVertex trg, per_pair_separation) {
+        return m_min_cut.find_min_cut(src, trg);
+    }
+
+    /// reads the min cut value between the vertices from the cut tree
+    double min_cut_value(AuxVertex src, AuxVertex trg, cut_tree_separation) {
+        return m_cut_tree.min_cut_value(src, trg);
     }
 
     /**
@@ -174,6 +208,7 @@ class steiner_network_violation_checker {
     }
 
     min_cut_finder m_min_cut;
+    gomory_hu_tree m_cut_tree;
 };
 
 } //! ir
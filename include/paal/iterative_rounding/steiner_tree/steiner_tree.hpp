@@ -20,6 +20,7 @@
 
 
 #include "paal/data_structures/metric/basic_metrics.hpp"
+#include "paal/iterative_rounding/check_violation_functor.hpp"
 #include "paal/iterative_rounding/ir_components.hpp"
 #include "paal/iterative_rounding/iterative_rounding.hpp"
 #include "paal/iterative_rounding/steiner_tree/steiner_components.hpp"
@@ -127,7 +128,7 @@ public:
     auto get_find_violation(LP & lp) {
         using candidate = steiner_tree_violation_checker::Candidate;
         return m_oracle([&](){return m_violation_checker.get_violation_candidates(*this, lp);},
-                        [&](candidate c){return m_violation_checker.check_violation(c, *this);},
+                        make_check_violation_functor(m_violation_checker, *this),
                         [&](candidate c){return m_violation_checker.add_violated_constraint(c, *this, lp);});
     }
 
@@ -19,6 +19,7 @@
 #include "paal/local_search/search_components.hpp"
 #include "paal/local_search/local_search.hpp"
 #include "paal/local_search/2_local_search/2_local_search_components.hpp"
+#include "paal/local_search/2_local_search/2_local_search_neighbor_lists.hpp"
 #include "paal/local_search/2_local_search/2_local_search_solution_adapter.hpp"
 #include "paal/data_structures/cycle/cycle_start_from_last_change.hpp"
 #include "paal/data_structures/cycle/cycle_concept.hpp"
@@ -81,6 +82,74 @@ auto get_default_two_local_components(const Metric &m) {
     return make_two_local_search_components(gain_two_opt<Metric>(m));
 }
 
+/**
+ * @brief components of 2-opt and Or-opt search restricted to the
+ * neighbors_count nearest neighbors of every vertex, with don't look bits.
+ * The cycle has to provide next and prev (e.g. simple_cycle or splay_cycle).
+ * Components should be used with first_improving_strategy.
+ * They keep the don't look bits, so searching again on the same cycle with
+ * the same components returns false immediately.
+ *
+ * @tparam Metric
+ * @tparam Vertices
+ * @param m metric
+ * @param vertices vertices of the cycle
+ * @param neighbors_count
+ * @param or_opt if false only 2-opt moves are considered
+ *
+ * @return
+ */
+template <typename Metric, typename Vertices>
+auto make_two_local_search_neighbor_components(const Metric &m,
+                                               const Vertices &vertices,
+                                               std::size_t neighbors_count = 12,
+                                               bool or_opt = true) {
+    using vertex_t = range_to_elem_t<Vertices>;
+    using get_moves_t = two_local_search_neighbor_get_moves<Metric, vertex_t>;
+    using commit_t = tsp_flips_move_commit<get_moves_t>;
+    get_moves_t get_moves(
+        tsp_neighbor_lists<Metric, vertex_t>(m, vertices, neighbors_count), or_opt);
+    commit_t commit(get_moves);
+    return TwoLocalcomponents<gain_tsp_flips_move<Metric>, get_moves_t, commit_t>(
+        gain_tsp_flips_move<Metric>(m), std::move(get_moves), std::move(commit));
+}
+
+/**
+ * @brief components of 2-opt and Or-opt search for points in the plane,
+ * restricted to the quadrant neighbors of every vertex, with don't look bits.
+ * The candidate lists are built using a grid of the points, see
+ * tsp_neighbor_lists. Otherwise as make_two_local_search_neighbor_components above.
+ *
+ * @tparam Metric
+ * @tparam Vertices
+ * @tparam Coordinates
+ * @param m metric
+ * @param vertices vertices of the cycle
+ * @param coordinates functor returning the coordinates (pair of doubles) of the vertex
+ * @param neighbors_count
+ * @param or_opt if false only 2-opt moves are considered
+ *
+ * @return
+ */
+template <typename Metric, typename Vertices, typename Coordinates,
+          typename = decltype(std::get<1>(std::declval<Coordinates>()(
+              std::declval<range_to_elem_t<Vertices>>())))>
+auto make_two_local_search_neighbor_components(const Metric &m,
+                                               const Vertices &vertices,
+                                               Coordinates coordinates,
+                                               std::size_t neighbors_count = 12,
+                                               bool or_opt = true) {
+    using vertex_t = range_to_elem_t<Vertices>;
+    using get_moves_t = two_local_search_neighbor_get_moves<Metric, vertex_t>;
+    using commit_t = tsp_flips_move_commit<get_moves_t>;
+    get_moves_t get_moves(
+        tsp_neighbor_lists<Metric, vertex_t>(m, vertices, neighbors_count,
+                                             std::move(coordinates)), or_opt);
+    commit_t commit(get_moves);
+    return TwoLocalcomponents<gain_tsp_flips_move<Metric>, get_moves_t, commit_t>(
+        gain_tsp_flips_move<Metric>(m), std::move(get_moves), std::move(commit));
+}
+
 /**
  * @brief local search for two - opt in tsp adapts tsp to
 * local_search_multi_solution
@@ -0,0 +1,823 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file 2_local_search_neighbor_lists.hpp
+ * @brief 2-opt and Or-opt moves restricted to the nearest neighbors
+ *        of the vertices, with don't look bits
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_2_LOCAL_SEARCH_NEIGHBOR_LISTS_HPP
+#define PAAL_2_LOCAL_SEARCH_NEIGHBOR_LISTS_HPP
+
+#include "paal/data_structures/bimap.hpp"
+#include "paal/data_structures/thread_pool.hpp"
+#include "paal/utils/irange.hpp"
+
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace paal {
+namespace local_search {
+
+/**
+ * @brief move consisting of at most three flips of the cycle.
+ *        It stores the removed and the added edges, so that the gain
+ *        can be computed without looking at the cycle.
+ *
+ * @tparam Vertex
+ */
+template <typename Vertex> class tsp_flips_move {
+  public:
+    /// edge of the cycle
+    using edge = std::pair<Vertex, Vertex>;
+
+    /// maximal number of removed (and added) edges
+    static const int max_edges = 3;
+
+    /**
+     * @brief adds edge removed from the cycle by the move
+     *
+     * @param e
+     */
+    void add_removed(edge e) {
+        assert(m_removed_count < max_edges);
+        m_removed[m_removed_count++] = e;
+    }
+
+    /**
+     * @brief adds edge added to the cycle by the move
+     *
+     * @param e
+     */
+    void add_added(edge e) {
+        assert(m_added_count < max_edges);
+        m_added[m_added_count++] = e;
+    }
+
+    /**
+     * @brief adds flip performed by the move, flips are performed in the order of adding
+     *
+     * @param begin
+     * @param end
+     */
+    void add_flip(Vertex begin, Vertex end) {
+        assert(m_flips_count < max_edges);
+        m_flips[m_flips_count++] = edge(begin, end);
+    }
+
+    /// removed edges
+    boost::iterator_range<const edge *> get_removed() const {
+        return boost::make_iterator_range(m_removed.data(), m_removed.data() + m_removed_count);
+    }
+
+    /// added edges
+    boost::iterator_range<const edge *> get_added() const {
+        return boost::make_iterator_range(m_added.data(), m_added.data() + m_added_count);
+    }
+
+    /// flips (begin, end) of the move
+    boost::iterator_range<const edge *> get_flips() const {
+        return boost::make_iterator_range(m_flips.data(), m_flips.data() + m_flips_count);
+    }
+
+  private:
+    std::array<edge, max_edges> m_removed;
+    std::array<edge, max_edges> m_added;
+    std::array<edge, max_edges> m_flips;
+    int m_removed_count = 0;
+    int m_added_count = 0;
+    int m_flips_count = 0;
+};
+
+namespace detail {
+
+/**
+ * @brief uniform grid of points in the plane, about two points per cell.
+ *        Used to find the nearest points without computing all the distances.
+ */
+class tsp_neighbor_grid {
+  public:
+    /// point coordinates
+    using point = std::pair<double, double>;
+
+    /**
+     * @brief constructor
+     *
+     * @param points
+     */
+    tsp_neighbor_grid(std::vector<point> points) : m_points(std::move(points)) {
+        auto const size = m_points.size();
+        if (size == 0) return;
+        auto x_range = std::minmax_element(m_points.begin(), m_points.end(),
+            [](point const &p, point const &q) { return p.first < q.first; });
+        auto y_range = std::minmax_element(m_points.begin(), m_points.end(),
+            [](point const &p, point const &q) { return p.second < q.second; });
+        m_min_x = x_range.first->first;
+        m_min_y = y_range.first->second;
+        auto const width = x_range.second->first - m_min_x;
+        auto const height = y_range.second->second - m_min_y;
+        // the second term bounds the number of cells when the points lie on a line
+        m_cell = std::max(std::sqrt(width * height * 2 / size),
+                          std::max(width, height) * 2 / size);
+        if (!(m_cell > 0)) {
+            m_cell = 1;
+        }
+        m_x_cells = int(width / m_cell) + 1;
+        m_y_cells = int(height / m_cell) + 1;
+
+        // points sorted by cells (counting sort)
+        m_cell_starts.assign(std::size_t(m_x_cells) * m_y_cells + 1, 0);
+        m_cell_of.resize(size);
+        for (auto i : irange(size)) {
+            m_cell_of[i] = cell(get_x_cell(m_points[i].first), get_y_cell(m_points[i].second));
+            ++m_cell_starts[m_cell_of[i] + 1];
+        }
+        std::partial_sum(m_cell_starts.begin(), m_cell_starts.end(), m_cell_starts.begin());
+        m_cell_points.resize(size);
+        auto next = m_cell_starts;
+        for (auto i : irange(size)) {
+            m_cell_points[next[m_cell_of[i]]++] = i;
+        }
+    }
+
+    /// coordinates of the point
+    const point &get_point(int i) const { return m_points[i]; }
+
+    /// side of the cell
+    double get_cell_size() const { return m_cell; }
+
+    /// number of cells in a row
+    int get_x_cells() const { return m_x_cells; }
+
+    /// number of cells in a column
+    int get_y_cells() const { return m_y_cells; }
+
+    /// column of the cell of the point
+    int get_x_cell(int i) const { return m_cell_of[i] % m_x_cells; }
+
+    /// row of the cell of the point
+    int get_y_cell(int i) const { return m_cell_of[i] / m_x_cells; }
+
+    /**
+     * @brief calls f(j) for every point j in the cells in the distance
+     *        (in the maximum metric) exactly r from the cell (x, y)
+     */
+    template <typename Functor>
+    void for_each_in_ring(int x, int y, int r, Functor f) const {
+        auto visit_row = [&](int row, int from, int to) {
+            if (row < 0 || row >= m_y_cells) return;
+            from = std::max(from, 0);
+            to = std::min(to, m_x_cells - 1);
+            for (int column = from; column <= to; ++column) {
+                visit_cell(column, row, f);
+            }
+        };
+        if (r == 0) {
+            visit_row(y, x, x);
+            return;
+        }
+        visit_row(y - r, x - r, x + r);
+        visit_row(y + r, x - r, x + r);
+        for (int row = std::max(y - r + 1, 0); row <= std::min(y + r - 1, m_y_cells - 1); ++row) {
+            if (x - r >= 0) visit_cell(x - r, row, f);
+            if (x + r < m_x_cells) visit_cell(x + r, row, f);
+        }
+    }
+
+  private:
+    int get_x_cell(double x) const {
+        return std::min(int((x - m_min_x) / m_cell), m_x_cells - 1);
+    }
+
+    int get_y_cell(double y) const {
+        return std::min(int((y - m_min_y) / m_cell), m_y_cells - 1);
+    }
+
+    std::size_t cell(int x, int y) const { return std::size_t(y) * m_x_cells + x; }
+
+    template <typename Functor>
+    void visit_cell(int x, int y, Functor &f) const {
+        auto c = cell(x, y);
+        for (auto i = m_cell_starts[c]; i < m_cell_starts[c + 1]; ++i) {
+            f(m_cell_points[i]);
+        }
+    }
+
+    std::vector<point> m_points;
+    double m_min_x = 0;
+    double m_min_y = 0;
+    double m_cell = 1;
+    int m_x_cells = 1;
+    int m_y_cells = 1;
+    std::vector<std::size_t> m_cell_of;
+    std::vector<std::size_t> m_cell_starts;
+    std::vector<int> m_cell_points;
+};
+
+/**
+ * @brief finds the quadrant neighbors of the point i:
+ *        neighbors_count / 4 nearest points in each of the four quadrants
+ *        around i, completed with the nearest remaining points.
+ *        Quadrant neighbors connect clusters of points,
+ *        which the nearest neighbors alone often fail to do.
+ *        Cells are visited in rings around the cell of i, until
+ *        none of the unvisited points can be closer than the found ones.
+ */
+class tsp_quadrant_neighbors_finder {
+    using candidate = std::pair<double, int>;
+
+    // keeps at most limit nearest candidates, the farthest one on the top
+    static void push(std::vector<candidate> &heap, std::size_t limit, candidate c) {
+        if (heap.size() < limit) {
+            heap.push_back(c);
+            std::push_heap(heap.begin(), heap.end());
+        } else if (limit > 0 && c < heap.front()) {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = c;
+            std::push_heap(heap.begin(), heap.end());
+        }
+    }
+
+    static bool full_within(std::vector<candidate> const &heap, std::size_t limit, double dist2) {
+        // strict comparison, so that ties are resolved by the index as for all points
+        return heap.size() == limit && (limit == 0 || heap.front().first < dist2);
+    }
+
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param grid
+     * @param neighbors_count
+     */
+    tsp_quadrant_neighbors_finder(const tsp_neighbor_grid &grid, std::size_t neighbors_count)
+        : m_grid(grid), m_neighbors_count(neighbors_count),
+          m_quadrant_count(neighbors_count / 4) {}
+
+    /// writes the neighbors of i (in no particular order) to result
+    void operator()(int i, std::vector<int> &result) {
+        m_nearest.clear();
+        for (auto &q : m_quadrants) q.clear();
+
+        auto const &p = m_grid.get_point(i);
+        int const x = m_grid.get_x_cell(i);
+        int const y = m_grid.get_y_cell(i);
+        int const last_ring = std::max(m_grid.get_x_cells(), m_grid.get_y_cells());
+        auto visit = [&](int j) {
+            if (j == i) return;
+            auto const &q = m_grid.get_point(j);
+            auto const dx = q.first - p.first;
+            auto const dy = q.second - p.second;
+            candidate c(dx * dx + dy * dy, j);
+            push(m_nearest, m_neighbors_count, c);
+            push(m_quadrants[(dx < 0 ? 1 : 0) + (dy < 0 ? 2 : 0)], m_quadrant_count, c);
+        };
+        for (int r = 0; r <= last_ring; ++r) {
+            m_grid.for_each_in_ring(x, y, r, visit);
+            // points in the further rings are farther than r cells
+            auto const bound = r * m_grid.get_cell_size();
+            auto const bound2 = bound * bound;
+            bool done = full_within(m_nearest, m_neighbors_count, bound2);
+            for (auto quadrant : irange(4)) {
+                // cells of further rings which can contain points of the quadrant
+                bool const right = quadrant % 2 == 0, up = quadrant < 2;
+                bool const exhausted =
+                    (right ? x + r + 1 >= m_grid.get_x_cells() : x - r - 1 < 0) &&
+                    (up ? y + r + 1 >= m_grid.get_y_cells() : y - r - 1 < 0);
+                done = done && (exhausted ||
+                                full_within(m_quadrants[quadrant], m_quadrant_count, bound2));
+            }
+            if (done) break;
+        }
+
+        result.clear();
+        for (auto const &q : m_quadrants) {
+            for (auto const &c : q) result.push_back(c.second);
+        }
+        std::sort(m_nearest.begin(), m_nearest.end());
+        for (auto const &c : m_nearest) {
+            if (result.size() == m_neighbors_count) break;
+            if (std::find(result.begin(), result.end(), c.second) == result.end()) {
+                result.push_back(c.second);
+            }
+        }
+    }
+
+  private:
+    const tsp_neighbor_grid &m_grid;
+    std::size_t m_neighbors_count;
+    std::size_t m_quadrant_count;
+    std::vector<candidate> m_nearest;
+    std::array<std::vector<candidate>, 4> m_quadrants;
+};
+
+} //!detail
+
+/**
+ * @brief candidate lists (k nearest vertices of every vertex)
+ *        and the queue of vertices whose don't look bits are off.
+ *        It is shared by the get_moves and commit components.
+ *
+ * @tparam Metric
+ * @tparam Vertex
+ */
+template <typename Metric, typename Vertex = int> class tsp_neighbor_lists {
+  public:
+    /**
+     * @brief computes candidate lists, all vertices are active.
+     *        Computation needs |vertices|^2 distance queries,
+     *        the rows are computed on threads_count threads.
+     *        For points in the plane use the constructor taking coordinates.
+     *
+     * @tparam Vertices
+     * @param metric
+     * @param vertices
+     * @param neighbors_count size of the candidate list of every vertex
+     * @param threads_count
+     */
+    template <typename Vertices>
+    tsp_neighbor_lists(const Metric &metric, const Vertices &vertices,
+                       std::size_t neighbors_count,
+                       unsigned threads_count = std::thread::hardware_concurrency())
+        : m_metric(metric), m_idx(vertices) {
+        auto const size = m_idx.size();
+        init(neighbors_count);
+        using dist_t = decltype(metric(std::declval<Vertex>(), std::declval<Vertex>()));
+        for_each_vertex(threads_count, [&]() {
+            std::vector<std::pair<dist_t, int>> row;
+            row.reserve(size);
+            return [&, row](std::size_t i) mutable {
+                row.clear();
+                auto v = m_idx.get_val(i);
+                for (auto j : irange(size)) {
+                    if (j != i) {
+                        row.emplace_back(metric(v, m_idx.get_val(j)), j);
+                    }
+                }
+                auto const middle = row.begin() + m_neighbors_count;
+                std::partial_sort(row.begin(), middle, row.end());
+                std::transform(row.begin(), middle,
+                               m_neighbors.begin() + i * m_neighbors_count,
+                               [](auto const &p) { return p.second; });
+            };
+        });
+    }
+
+    /**
+     * @brief computes candidate lists of points in the plane, all vertices are active.
+     *        Candidates are the quadrant neighbors: neighbors_count / 4 nearest
+     *        vertices in each quadrant around the vertex, completed with
+     *        the nearest remaining vertices. They are found using a grid of
+     *        the points (expected O(|vertices| * neighbors_count) time for
+     *        evenly spread points) and sorted by the metric.
+     *        The coordinates are compared with the Euclidean distance, so the metric
+     *        should be close to it (e.g. rounded Euclidean distance).
+     *
+     * @tparam Vertices
+     * @tparam Coordinates
+     * @param metric
+     * @param vertices
+     * @param neighbors_count size of the candidate list of every vertex
+     * @param coordinates functor returning the coordinates (pair of doubles) of the vertex
+     * @param threads_count
+     */
+    template <typename Vertices, typename Coordinates,
+              typename = decltype(std::get<1>(std::declval<Coordinates>()(std::declval<Vertex>())))>
+    tsp_neighbor_lists(const Metric &metric, const Vertices &vertices,
+                       std::size_t neighbors_count, Coordinates coordinates,
+                       unsigned threads_count = std::thread::hardware_concurrency())
+        : m_metric(metric), m_idx(vertices) {
+        auto const size = m_idx.size();
+        init(neighbors_count);
+        std::vector<detail::tsp_neighbor_grid::point> points;
+        points.reserve(size);
+        for (auto i : irange(size)) {
+            auto const &c = coordinates(m_idx.get_val(i));
+            points.emplace_back(std::get<0>(c), std::get<1>(c));
+        }
+        detail::tsp_neighbor_grid grid(std::move(points));
+        using dist_t = decltype(metric(std::declval<Vertex>(), std::declval<Vertex>()));
+        for_each_vertex(threads_count, [&]() {
+            detail::tsp_quadrant_neighbors_finder finder(grid, m_neighbors_count);
+            std::vector<int> neighbors;
+            std::vector<std::pair<dist_t, int>> row;
+            return [&, finder, neighbors, row](std::size_t i) mutable {
+                finder(i, neighbors);
+                row.clear();
+                auto v = m_idx.get_val(i);
+                for (auto j : neighbors) {
+                    row.emplace_back(metric(v, m_idx.get_val(j)), j);
+                }
+                std::sort(row.begin(), row.end());
+                std::transform(row.begin(), row.end(),
+                               m_neighbors.begin() + i * m_neighbors_count,
+                               [](auto const &p) { return p.second; });
+            };
+        });
+    }
+
+    /// metric
+    const Metric &get_metric() const { return m_metric; }
+
+    /// number of vertices
+    std::size_t size() const { return m_idx.size(); }
+
+    /// vertex of the given index
+    const Vertex &get_vertex(int i) const { return m_idx.get_val(i); }
+
+    /// index of the given vertex
+    int get_idx(const Vertex &v) const { return m_idx.get_idx(v); }
+
+    /// indices of the nearest vertices of the vertex with index i, sorted by distance
+    boost::iterator_range<const int *> get_neighbors(int i) const {
+        auto begin = m_neighbors.data() + i * m_neighbors_count;
+        return boost::make_iterator_range(begin, begin + m_neighbors_count);
+    }
+
+    /// is there any active vertex
+    bool has_active() const { return !m_queue.empty(); }
+
+    /// index of the first active vertex
+    int first_active() const { return m_queue.front(); }
+
+    /// turns on the don't look bit of the first active vertex
+    void deactivate_first() {
+        m_active[m_queue.front()] = false;
+        m_queue.pop_front();
+    }
+
+    /// turns off the don't look bit of the vertex
+    void activate(const Vertex &v) {
+        auto i = get_idx(v);
+        if (!m_active[i]) {
+            m_active[i] = true;
+            m_queue.push_back(i);
+        }
+    }
+
+  private:
+    void init(std::size_t neighbors_count) {
+        auto const size = m_idx.size();
+        m_neighbors_count = std::min(neighbors_count, size == 0 ? 0 : size - 1);
+        m_neighbors.resize(size * m_neighbors_count);
+        m_active.assign(size, true);
+        for (auto i : irange(size)) {
+            m_queue.push_back(i);
+        }
+    }
+
+    // computes rows of all vertices on threads_count threads,
+    // make_row is called once per thread and returns the functor computing a single row
+    template <typename MakeRow>
+    void for_each_vertex(unsigned threads_count, MakeRow make_row) {
+        auto const size = m_idx.size();
+        std::atomic<std::size_t> next_vertex(0);
+        threads_count = std::max(threads_count, 1u);
+        thread_pool threads(threads_count);
+        for (auto t : irange(threads_count)) {
+            static_cast<void>(t);
+            threads.post([&]() {
+                auto row = make_row();
+                for (std::size_t i; (i = next_vertex++) < size;) {
+                    row(i);
+                }
+            });
+        }
+        threads.run();
+    }
+
+    const Metric &m_metric;
+    data_structures::bimap<Vertex> m_idx;
+    std::size_t m_neighbors_count;
+    std::vector<int> m_neighbors;
+    std::vector<bool> m_active;
+    std::deque<int> m_queue;
+};
+
+namespace detail {
+
+/**
+ * @brief fills moves for the vertex a: 2-opt moves and Or-opt moves
+ *        of segments (of length at most 3) starting or ending in a.
+ *        All moves add edge (a, c) where c is one of the neighbors of a.
+ *        As usual for the neighbor lists, only c closer to a than
+ *        one of the cycle neighbors of a are considered.
+ */
+template <typename NeighborLists, typename Cycle, typename Move>
+void fill_tsp_neighbor_moves(const NeighborLists &lists, const Cycle &cycle,
+                             int a_idx, bool or_opt, std::vector<Move> &moves) {
+    using vertex = typename std::decay<decltype(lists.get_vertex(0))>::type;
+    auto const &m = lists.get_metric();
+    auto const size = lists.size();
+    if (size < 5) return;
+
+    vertex a = lists.get_vertex(a_idx);
+    vertex na = cycle.next(a);
+    vertex pa = cycle.prev(a);
+    auto const d_next = m(a, na);
+    auto const d_prev = m(pa, a);
+
+    for (auto c_idx : lists.get_neighbors(a_idx)) {
+        vertex c = lists.get_vertex(c_idx);
+        auto const d = m(a, c);
+        if (!(d < d_next) && !(d < d_prev)) break;
+        vertex nc = cycle.next(c);
+        vertex pc = cycle.prev(c);
+
+        // 2-opt: (a, na), (c, nc) -> (a, c), (na, nc)
+        if (d < d_next && c != na && c != pa) {
+            Move move;
+            move.add_removed({a, na});
+            move.add_removed({c, nc});
+            move.add_added({a, c});
+            move.add_added({na, nc});
+            move.add_flip(na, c);
+            moves.push_back(move);
+        }
+        // 2-opt: (pa, a), (pc, c) -> (a, c), (pa, pc)
+        if (d < d_prev && c != na && c != pa) {
+            Move move;
+            move.add_removed({pa, a});
+            move.add_removed({pc, c});
+            move.add_added({a, c});
+            move.add_added({pa, pc});
+            move.add_flip(a, pc);
+            moves.push_back(move);
+        }
+        if (!or_opt) continue;
+
+        // Or-opt: segment s1..s2 (forward) moved between x and y = next(x)
+        // so that a becomes a neighbor of c.
+        // flip(s1, x) and flip(x, n) give p n..x s2..s1 y,
+        // the additional flip(s2, s1) gives p n..x s1..s2 y.
+        auto add_or_opt = [&](vertex p, vertex s1, vertex s2, vertex n,
+                              vertex x, vertex y, bool forward) {
+            Move move;
+            move.add_removed({p, s1});
+            move.add_removed({s2, n});
+            move.add_removed({x, y});
+            move.add_added({p, n});
+            move.add_flip(s1, x);
+            move.add_flip(x, n);
+            if (forward) {
+                move.add_added({x, s1});
+                move.add_added({s2, y});
+                move.add_flip(s2, s1);
+            } else {
+                move.add_added({x, s2});
+                move.add_added({s1, y});
+            }
+            moves.push_back(move);
+        };
+
+        // segment a..s, (pa, a) is removed
+        if (d < d_prev) {
+            vertex s = a;
+            for (int len = 1; len <= 3 && std::size_t(len + 3) <= size; ++len) {
+                if (len > 1) {
+                    s = cycle.next(s);
+                    if (s == c) break;
+                }
+                vertex n = cycle.next(s);
+                // c a..s nc
+                if (c != pa) {
+                    add_or_opt(pa, a, s, n, c, nc, true);
+                }
+                // pc s..a c
+                if (c != n) {
+                    add_or_opt(pa, a, s, n, pc, c, false);
+                }
+            }
+        }
+        // segment s..a, (a, na) is removed
+        if (d < d_next) {
+            vertex s = a;
+            for (int len = 1; len <= 3 && std::size_t(len + 3) <= size; ++len) {
+                if (len > 1) {
+                    s = cycle.prev(s);
+                    if (s == c) break;
+                }
+                vertex p = cycle.prev(s);
+                // pc s..a c
+                if (c != na) {
+                    add_or_opt(p, s, a, na, pc, c, true);
+                }
+                // c a..s nc
+                if (c != p) {
+                    add_or_opt(p, s, a, na, c, nc, false);
+                }
+            }
+        }
+    }
+}
+
+} //!detail
+
+/**
+ * @brief gain of tsp_flips_move: length of removed edges - length of added edges
+ *
+ * @tparam Metric
+ */
+template <typename Metric> class gain_tsp_flips_move {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param m fulfills \ref metric concept.
+     */
+    gain_tsp_flips_move(const Metric &m) : m_metric(m) {}
+
+    /**
+     * @brief returns gain for given move
+     *
+     * @tparam Solution
+     * @tparam Vertex
+     * @param move
+     *
+     * @return
+     */
+    template <typename Solution, typename Vertex>
+    auto operator()(const Solution &, const tsp_flips_move<Vertex> &move) const {
+        decltype(m_metric(std::declval<Vertex>(), std::declval<Vertex>())) gain{};
+        for (auto const &e : move.get_removed()) {
+            gain += m_metric(e.first, e.second);
+        }
+        for (auto const &e : move.get_added()) {
+            gain -= m_metric(e.first, e.second);
+        }
+        return gain;
+    }
+
+  private:
+    const Metric &m_metric;
+};
+
+/**
+ * @brief GetMoves for 2-opt/Or-opt with neighbor lists and don't look bits.
+ *        The range of moves is computed lazily, vertex after vertex from
+ *        the queue of active vertices. When all moves of the vertex are
+ *        iterated over (none of them was committed) the don't look bit of
+ *        the vertex is turned on. The range is empty when all vertices have
+ *        don't look bits on, which ends the search.
+ *        This is meant to be used with first_improving_strategy.
+ *
+ * @tparam Metric
+ * @tparam Vertex
+ */
+template <typename Metric, typename Vertex = int>
+class two_local_search_neighbor_get_moves {
+    using lists_t = tsp_neighbor_lists<Metric, Vertex>;
+    using move_t = tsp_flips_move<Vertex>;
+
+    struct state {
+        state(lists_t lists) : m_lists(std::move(lists)) {}
+        lists_t m_lists;
+        std::vector<move_t> m_moves;
+    };
+
+    template <typename Cycle>
+    class iterator : public boost::iterator_facade<iterator<Cycle>, const move_t,
+                                                   boost::single_pass_traversal_tag> {
+      public:
+        iterator() = default;
+
+        iterator(state *s, const Cycle *cycle, bool or_opt)
+            : m_state(s), m_cycle(cycle), m_or_opt(or_opt) {
+            fill();
+        }
+
+      private:
+        friend class boost::iterator_core_access;
+
+        void fill() {
+            auto &lists = m_state->m_lists;
+            m_state->m_moves.clear();
+            m_position = 0;
+            while (lists.has_active()) {
+                detail::fill_tsp_neighbor_moves(lists, *m_cycle, lists.first_active(),
+                                                m_or_opt, m_state->m_moves);
+                if (!m_state->m_moves.empty()) {
+                    return;
+                }
+                lists.deactivate_first();
+            }
+            m_state = nullptr;
+        }
+
+        void increment() {
+            if (++m_position == m_state->m_moves.size()) {
+                m_state->m_lists.deactivate_first();
+                fill();
+            }
+        }
+
+        bool equal(const iterator &other) const {
+            return m_state == other.m_state &&
+                   (m_state == nullptr || m_position == other.m_position);
+        }
+
+        const move_t &dereference() const { return m_state->m_moves[m_position]; }
+
+        state *m_state = nullptr;
+        const Cycle *m_cycle = nullptr;
+        bool m_or_opt = true;
+        std::size_t m_position = 0;
+    };
+
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param lists candidate lists
+     * @param or_opt if false only 2-opt moves are generated
+     */
+    two_local_search_neighbor_get_moves(lists_t lists, bool or_opt = true)
+        : m_state(std::make_shared<state>(std::move(lists))), m_or_opt(or_opt) {}
+
+    /**
+     * @brief returns moves of the active vertices
+     *
+     * @tparam Solution
+     * @param solution
+     */
+    template <typename Solution>
+    auto operator()(const Solution &solution) const {
+        using cycle_t = typename std::decay<decltype(solution.get_cycle())>::type;
+        return boost::make_iterator_range(
+            iterator<cycle_t>(m_state.get(), &solution.get_cycle(), m_or_opt),
+            iterator<cycle_t>());
+    }
+
+    /// candidate lists with don't look bits
+    lists_t &get_neighbor_lists() { return m_state->m_lists; }
+
+  private:
+    std::shared_ptr<state> m_state;
+    bool m_or_opt;
+};
+
+/**
+ * @brief Commit for tsp_flips_move, performs the flips and
+ *        turns off don't look bits of the endpoints of the changed edges
+ *
+ * @tparam GetMoves
+ */
+template <typename GetMoves> class tsp_flips_move_commit {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param get_moves component owning the don't look bits
+     */
+    tsp_flips_move_commit(GetMoves get_moves) : m_get_moves(std::move(get_moves)) {}
+
+    /**
+     * @brief performs the flips of the move
+     *
+     * @tparam Solution
+     * @tparam Vertex
+     * @param s
+     * @param move
+     */
+    template <typename Solution, typename Vertex>
+    bool operator()(Solution &s, const tsp_flips_move<Vertex> &move) {
+        for (auto const &f : move.get_flips()) {
+            s.get_cycle().flip(f.first, f.second);
+        }
+        auto &lists = m_get_moves.get_neighbor_lists();
+        for (auto const &e : move.get_removed()) {
+            lists.activate(e.first);
+            lists.activate(e.second);
+        }
+        return true;
+    }
+
+  private:
+    // copy shares the state with the original
+    GetMoves m_get_moves;
+};
+
+} //!local_search
+} //!paal
+
+#endif // PAAL_2_LOCAL_SEARCH_NEIGHBOR_LISTS_HPP
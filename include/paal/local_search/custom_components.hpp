@@ -21,6 +21,7 @@
 
 #include <chrono>
 #include <random>
+#include <type_traits>
 
 namespace paal {
 namespace local_search {
@@ -253,14 +254,18 @@ template <typename Gain, typename ValueType> struct compute_gain_wrapper {
 };
 
 /**
- * @brief Adapts gain to implement tabu search
+ * @brief Adapts gain to implement tabu search.
+ *        Tabu move is allowed if tabuAspiration(gain, solution, move) is true,
+ *        e.g. aspiration_beats_best, such move is not added to the tabu list.
  *
  * @tparam TabuList
  * @tparam Gain
  * @tparam AspirationCriteria
+ * @tparam TabuAspiration
  */
 template <typename TabuList, typename Gain = utils::return_one_functor,
-          typename AspirationCriteria = utils::always_true>
+          typename AspirationCriteria = utils::always_true,
+          typename TabuAspiration = utils::always_false>
 struct tabu_gain_adaptor {
 
     /**
@@ -269,13 +274,16 @@ struct tabu_gain_adaptor {
      * @param tabuList
      * @param gain
      * @param aspirationCriteria
+     * @param tabuAspiration
      */
     tabu_gain_adaptor(TabuList tabuList = TabuList(), Gain gain = Gain(),
                       AspirationCriteria aspirationCriteria =
-                          AspirationCriteria())
+                          AspirationCriteria(),
+                      TabuAspiration tabuAspiration = TabuAspiration())
         : m_tabu_list(std::move(tabuList)),
           m_aspiration_criteria_gain(std::move(gain),
-                                     std::move(aspirationCriteria)) {}
+                                     std::move(aspirationCriteria)),
+          m_tabu_aspiration(std::move(tabuAspiration)) {}
 
     /**
      * @brief operator()
@@ -294,13 +302,21 @@ struct tabu_gain_adaptor {
             }
             return diff;
         }
-        return decltype(std::declval<Gain>()(std::forward<Args>(args)...)){};
+        using delta_t = decltype(std::declval<Gain>()(std::forward<Args>(args)...));
+        if (!std::is_same<TabuAspiration, utils::always_false>::value) {
+            auto diff = m_aspiration_criteria_gain(std::forward<Args>(args)...);
+            if (m_tabu_aspiration(diff, std::forward<Args>(args)...)) {
+                return diff;
+            }
+        }
+        return delta_t{};
     }
 
   private:
     TabuList m_tabu_list;
     conditional_gain_adaptor<Gain, AspirationCriteria>
         m_aspiration_criteria_gain;
+    TabuAspiration m_tabu_aspiration;
 };
 
 /**
@@ -316,13 +332,145 @@ struct tabu_gain_adaptor {
  * @return
  */
 template <typename TabuList, typename Gain = utils::always_true,
-          typename AspirationCriteria = utils::always_true>
-tabu_gain_adaptor<TabuList, Gain, AspirationCriteria>
+          typename AspirationCriteria = utils::always_true,
+          typename TabuAspiration = utils::always_false>
+tabu_gain_adaptor<TabuList, Gain, AspirationCriteria, TabuAspiration>
 make_tabu_gain_adaptor(TabuList tabuList, Gain gain = Gain(),
                        AspirationCriteria aspirationCriteria =
-                           AspirationCriteria()) {
-    return tabu_gain_adaptor<TabuList, Gain, AspirationCriteria>(
-        std::move(tabuList), std::move(gain), std::move(aspirationCriteria));
+                           AspirationCriteria(),
+                       TabuAspiration tabuAspiration = TabuAspiration()) {
+    return tabu_gain_adaptor<TabuList, Gain, AspirationCriteria, TabuAspiration>(
+        std::move(tabuList), std::move(gain), std::move(aspirationCriteria),
+        std::move(tabuAspiration));
+}
+
+/**
+ * @brief Aspiration for tabu_gain_adaptor,
+ *        tabu move is allowed if the new solution is better than the best one.
+ *        Compares current + gain with best, where current and best are the
+ *        objective values maintained by track_objective_commit_adapter,
+ *        so the check does not evaluate the objective.
+ *
+ * @tparam Value
+ */
+template <typename Value> class aspiration_beats_best {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param current objective value of the current solution
+     * @param best objective value of the best solution
+     */
+    aspiration_beats_best(const Value &current, const Value &best)
+        : m_current(&current), m_best(&best) {}
+
+    /**
+     * @brief operator()
+     *
+     * @tparam Delta
+     * @tparam Args
+     * @param delta gain of the move
+     *
+     * @return
+     */
+    template <typename Delta, typename... Args>
+    bool operator()(Delta delta, Args &&...) const {
+        return *m_current + delta > *m_best;
+    }
+
+  private:
+    const Value *m_current;
+    const Value *m_best;
+};
+
+/**
+ * @brief make function for aspiration_beats_best
+ *
+ * @tparam Value
+ * @param current
+ * @param best
+ *
+ * @return
+ */
+template <typename Value>
+aspiration_beats_best<Value> make_aspiration_beats_best(const Value &current,
+                                                        const Value &best) {
+    return aspiration_beats_best<Value>(current, best);
+}
+
+/**
+ * @brief Adaptor on Commit which keeps the objective value of the current
+ *        solution and the best value seen so far.
+ *        The objective is evaluated once per commit.
+ *        Both values have to be initialized with the objective value of the
+ *        starting solution.
+ *
+ * @tparam Commit
+ * @tparam Objective
+ * @tparam Value
+ */
+template <typename Commit, typename Objective, typename Value>
+class track_objective_commit_adapter {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param commit
+     * @param objective
+     * @param current
+     * @param best
+     */
+    track_objective_commit_adapter(Commit commit, Objective objective,
+                                   Value &current, Value &best)
+        : m_commit(std::move(commit)), m_objective(std::move(objective)),
+          m_current(&current), m_best(&best) {}
+
+    /**
+     * @brief commits the move and updates the values
+     *
+     * @tparam Solution
+     * @tparam Move
+     * @param sol
+     * @param move
+     *
+     * @return
+     */
+    template <typename Solution, typename Move>
+    bool operator()(Solution &sol, const Move &move) {
+        auto ret = m_commit(sol, move);
+        *m_current = m_objective(sol);
+        if (*m_current > *m_best) {
+            *m_best = *m_current;
+        }
+        return ret;
+    }
+
+  private:
+    Commit m_commit;
+    Objective m_objective;
+    Value *m_current;
+    Value *m_best;
+};
+
+/**
+ * @brief make function for track_objective_commit_adapter
+ *
+ * @tparam Commit
+ * @tparam Objective
+ * @tparam Value
+ * @param commit
+ * @param objective
+ * @param current
+ * @param best
+ *
+ * @return
+ */
+template <typename Commit, typename Objective, typename Value>
+track_objective_commit_adapter<Commit, Objective, Value>
+make_track_objective_commit_adapter(Commit commit, Objective objective,
+                                    Value &current, Value &best) {
+    return track_objective_commit_adapter<Commit, Objective, Value>(
+        std::move(commit), std::move(objective), current, best);
 }
 
 /**
@@ -23,6 +23,9 @@
 
 #include "paal/data_structures/facility_location/facility_location_solution.hpp"
 #include "paal/local_search/local_search.hpp"
+#include "paal/data_structures/components/component_traits.hpp"
+
+#include <type_traits>
 
 namespace paal {
 namespace local_search {
@@ -54,6 +57,33 @@ using default_swap_fl_components =
                            facility_location_gain_swap,
                            facility_location_commit_swap>;
 
+/**
+ * @brief Swap components for facility location with the gain computed
+ * without modifying the solution (faster for many clients)
+ *
+ */
+using read_only_swap_fl_components =
+    Multisearch_components<facility_locationget_moves_swap,
+                           facility_location_gain_swap_read_only,
+                           facility_location_commit_swap>;
+
+namespace detail {
+
+/// true if the gains of all components can be called concurrently,
+/// other facility location gains modify the solution tentatively
+template <typename... Components>
+struct fl_gains_read_only : std::true_type {};
+
+template <typename Components, typename... Rest>
+struct fl_gains_read_only<Components, Rest...>
+    : std::integral_constant<bool,
+          std::is_same<typename data_structures::component_traits<
+                           Components>::template type<Gain>::type,
+                       facility_location_gain_swap_read_only>::value &&
+          fl_gains_read_only<Rest...>::value> {};
+
+} //! detail
+
 /**
  * facility_location_local_search
  * @brief this is model of LocalSearchStepMultiSolution concept. See \ref
@@ -75,6 +105,9 @@ using default_swap_fl_components =
  *
  * example file is facility_location_example.cpp
  *
+ * Strategies calling the gain concurrently (e.g. parallel_best_improving_strategy)
+ * can be used only with read_only_swap_fl_components.
+ *
  * @tparam voronoi
  * @tparam FacilityCost
  * @tparam Multisearch_components
@@ -87,6 +120,10 @@ bool facility_location_local_search(facility_location_solution &fls,
                                     ContinueOnSuccess on_success,
                                     ContinueOnFail on_fail,
                                     components... comps) {
+    static_assert(!calls_gain_concurrently<SearchStrategy>::value ||
+                      detail::fl_gains_read_only<components...>::value,
+                  "this search strategy calls the gain concurrently, "
+                  "use read_only_swap_fl_components");
     typedef facility_location_solution_adapter<facility_location_solution> FLSA;
     FLSA flsa(fls);
     return local_search(flsa, std::move(searchStrategy), std::move(on_success),
@@ -27,8 +27,13 @@
 #include <boost/range/distance.hpp>
 #include <boost/range/algorithm/find.hpp>
 
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace paal {
 namespace local_search {
@@ -76,6 +81,86 @@ class facility_location_solution_adapter {
     /// index of last facility removed from chosen
     std::size_t m_last_used_chosen;
 
+    /// two nearest chosen facilities of a client
+    struct nearest_facilities {
+        VertexType m_first_facility;
+        Dist m_first;
+        Dist m_second;
+        bool m_has_second;
+    };
+    using NearestFacilities = std::unordered_map<VertexType, nearest_facilities,
+                                                 boost::hash<VertexType>>;
+    using FacilityClients = std::unordered_map<VertexType, std::vector<VertexType>,
+                                               boost::hash<VertexType>>;
+    /// computed at most once, also when the gain is called concurrently
+    struct add_cost_entry {
+        std::once_flag m_computed;
+        Dist m_cost{};
+    };
+    using AddCosts = std::unordered_map<VertexType, add_cost_entry, boost::hash<VertexType>>;
+    /// nearest facilities of clients, valid only if m_nearest_valid
+    NearestFacilities m_nearest;
+    /// clients grouped by the nearest facility (in the sense of m_nearest)
+    FacilityClients m_clients_of_nearest;
+    /// change of the connection cost after adding a facility (without removing any)
+    AddCosts m_add_costs;
+    bool m_nearest_valid = false;
+
+    void compute_nearest() {
+        auto const &voronoi = m_sol.get_voronoi();
+        auto const &metric = voronoi.get_metric();
+        m_nearest.clear();
+        m_clients_of_nearest.clear();
+        m_add_costs.clear();
+        for (auto v : voronoi.get_vertices()) {
+            nearest_facilities n{ VertexType{}, Dist{}, Dist{}, false };
+            bool has_first = false;
+            for (auto f : m_chosen_copy) {
+                auto d = metric(v, f);
+                if (!has_first || d < n.m_first) {
+                    if (has_first) {
+                        n.m_second = n.m_first;
+                        n.m_has_second = true;
+                    }
+                    n.m_first = d;
+                    n.m_first_facility = f;
+                    has_first = true;
+                } else if (!n.m_has_second || d < n.m_second) {
+                    n.m_second = d;
+                    n.m_has_second = true;
+                }
+            }
+            assert(has_first);
+            m_nearest.emplace(v, n);
+            m_clients_of_nearest[n.m_first_facility].push_back(v);
+        }
+        // only the entries are created, the costs are computed on the first use,
+        // so strategies which do not evaluate every swap do not pay for all of them
+        for (auto to : m_unchosen_copy) {
+            m_add_costs[to];
+        }
+        m_nearest_valid = true;
+    }
+
+    Dist compute_add_cost(VertexType to) const {
+        auto const &metric = m_sol.get_voronoi().get_metric();
+        Dist cost{};
+        for (auto const &v_nearest : m_nearest) {
+            cost += std::min(metric(v_nearest.first, to) - v_nearest.second.m_first, Dist{});
+        }
+        return cost;
+    }
+
+    Dist add_cost(VertexType to) {
+        auto entry = m_add_costs.find(to);
+        if (entry == m_add_costs.end()) {
+            return compute_add_cost(to);
+        }
+        auto &e = entry->second;
+        std::call_once(e.m_computed, [&]() { e.m_cost = compute_add_cost(to); });
+        return e.m_cost;
+    }
+
 public:
     /**
      * @brief constructor creates cycled range of all facilities
@@ -106,6 +191,7 @@ public:
      * @return
      */
     Dist add_facility(VertexType v) {
+        m_nearest_valid = false;
         auto ret = add_facility_tentative(v);
         auto elemIter = boost::range::find(m_unchosen_copy, v);
         assert(elemIter != m_unchosen_copy.end());
@@ -134,6 +220,7 @@ public:
      * @return
      */
     Dist remove_facility(VertexType v) {
+        m_nearest_valid = false;
         auto ret = remove_facility_tentative(v);
         m_unchosen_copy.push_back(v);
         auto elemIter = boost::range::find(m_chosen_copy, v);
@@ -143,6 +230,46 @@ public:
         return ret;
     }
 
+    /**
+     * @brief returns diff between new cost and old cost after replacing chosen
+     *        facility from with unchosen facility to, the solution is not modified.
+     *
+     *        The nearest and the second nearest chosen facility of every client
+     *        are cached and recomputed lazily after add_facility/remove_facility.
+     *        For given to, the change of cost of all clients after adding to is
+     *        computed once (one scan of clients), then only clients whose nearest
+     *        facility is from are visited.
+     *        Once the nearest facilities are cached (by the first call after
+     *        a commit), calls can be made concurrently.
+     *        Tentative additions and removals are assumed to be reverted
+     *        before this function is called.
+     *        Requires voronoi assigning every client to its nearest facility.
+     *
+     * @param from
+     * @param to
+     *
+     * @return
+     */
+    Dist swap_facilities_tentative(VertexType from, VertexType to) {
+        if (!m_nearest_valid) {
+            compute_nearest();
+        }
+        auto const &metric = m_sol.get_voronoi().get_metric();
+        Dist cost = m_sol.get_facility_cost(to) - m_sol.get_facility_cost(from) + add_cost(to);
+        auto clients = m_clients_of_nearest.find(from);
+        if (clients == m_clients_of_nearest.end()) {
+            return cost;
+        }
+        for (auto v : clients->second) {
+            auto const &n = m_nearest.at(v);
+            auto const to_dist = metric(v, to);
+            // the cost of adding to assumed that v stays connected to from if to is farther
+            cost -= std::min(to_dist - n.m_first, Dist{});
+            cost += (n.m_has_second ? std::min(to_dist, n.m_second) : to_dist) - n.m_first;
+        }
+        return cost;
+    }
+
     /**
      * @brief get solution
      *
@@ -115,6 +115,31 @@ struct facility_location_gain_swap {
     }
 };
 
+/**
+ * @brief gain functor for swap in facility location problem,
+ *        which does not modify the solution.
+ *        The gain is computed from the nearest and second nearest chosen
+ *        facility of every client, see
+ *        facility_location_solution_adapter::swap_facilities_tentative.
+ *        Works only for voronoi assigning clients to the nearest facility
+ *        (e.g. not for capacitated_voronoi).
+ */
+struct facility_location_gain_swap_read_only {
+    /**
+     * @brief operator()
+     *
+     * @tparam Solution
+     * @param sol
+     * @param s
+     *
+     * @return
+     */
+    template <class Solution, class VertexType>
+    auto operator()(Solution &sol, const Swap<VertexType> &s) const {
+        return -sol.swap_facilities_tentative(s.get_from(), s.get_to());
+    }
+};
+
 /**
  * @brief commit functor for facility location problem
  */
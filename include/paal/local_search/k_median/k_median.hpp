@@ -33,6 +33,17 @@ using default_k_median_components =
         facility_locationget_moves_swap,
         facility_location_gain_swap,
         facility_location_commit_swap>;
+
+/**
+ * @class read_only_k_median_components
+ * @brief Model of Multisearch_components for k-median with the gain computed
+ * without modifying the solution (faster for many clients).
+ */
+using read_only_k_median_components =
+    Multisearch_components<
+        facility_locationget_moves_swap,
+        facility_location_gain_swap_read_only,
+        facility_location_commit_swap>;
 }
 }
 
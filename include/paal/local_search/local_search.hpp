@@ -21,13 +21,20 @@
 #include "paal/utils/fusion_algorithms.hpp"
 #include "paal/utils/infinity.hpp"
 #include "paal/data_structures/components/component_traits.hpp"
+#include "paal/data_structures/thread_pool.hpp"
 
 #include <boost/fusion/include/vector.hpp>
+#include <boost/range/algorithm/copy.hpp>
 #include <boost/range/algorithm/max_element.hpp>
 
 #include <utility>
 #include <algorithm>
 #include <functional>
+#include <memory>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 namespace paal {
 namespace local_search {
@@ -171,6 +178,160 @@ struct best_improving_strategy {
     data_structures::polymorfic_fold m_fold;
 };
 
+/**
+ * @brief functor used in fold in order to find the most
+ * improving move, gains of the moves are computed by many threads.
+ * The moves are copied to a vector and split into contiguous chunks,
+ * one chunk per thread. The chosen move is the same as the one chosen by max_functor.
+ *
+ * Thread safety: Gain is called concurrently by many threads for the same solution
+ * (and the same Gain object), so it must not modify the solution nor its own state
+ * without synchronization. Gains which change the solution tentatively and revert it
+ * (e.g. default facility location gains) cannot be used.
+ * The gain of the first move is computed by the current thread before the workers start,
+ * so gains building lazy caches on the first call are fine.
+ * GetMoves and Commit are called by the current thread only.
+ *
+ * The threads are created once, in the constructor, and reused in every step.
+ * A copy of the functor gets its own threads. The functor must not be used
+ * by many searches at the same time.
+ */
+class parallel_max_functor {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param threads_count
+     */
+    parallel_max_functor(unsigned threads_count = std::thread::hardware_concurrency())
+        : m_threads_count(std::max(threads_count, 1u)),
+          m_threads(std::make_unique<persistent_thread_pool>(m_threads_count)) {}
+
+    /// copy constructor, creates a new pool of the same size
+    /// (works also for a moved from functor)
+    parallel_max_functor(parallel_max_functor const &other)
+        : m_threads_count(other.m_threads_count),
+          m_threads(std::make_unique<persistent_thread_pool>(m_threads_count)) {}
+
+    /// move constructor
+    parallel_max_functor(parallel_max_functor &&) = default;
+
+    /**
+     * @brief operator()
+     *
+     * @tparam componentsAndSolution
+     * @tparam AccumulatorFunctor
+     * @tparam AccumulatorData
+     * @tparam Continuation
+     * @param compsAndSol
+     * @param accumulatorFunctor
+     * @param accumulatorData
+     * @param continuation
+     *
+     * @return
+     */
+    template <typename componentsAndSolution, typename AccumulatorFunctor,
+              typename AccumulatorData, typename Continuation>
+    bool operator()(componentsAndSolution &compsAndSol,
+                    AccumulatorFunctor accumulatorFunctor,
+                    AccumulatorData accumulatorData,
+                    Continuation continuation) const {
+        auto &comps = compsAndSol.first;
+        auto &solution = compsAndSol.second;
+        auto && adjustmentSet = comps.template call<GetMoves>(solution);
+
+        using move_t = typename std::decay<decltype(*std::begin(adjustmentSet))>::type;
+        std::vector<move_t> moves;
+        boost::copy(adjustmentSet, std::back_inserter(moves));
+
+        if (moves.empty()) {
+            return continuation(accumulatorFunctor, accumulatorData);
+        }
+
+        auto firstGain = comps.template call<Gain>(solution, moves.front());
+        using best_t = std::pair<decltype(firstGain), std::size_t>;
+
+        auto const chunksCount = std::min<std::size_t>(m_threads->size(), moves.size());
+        std::vector<best_t> chunksBest(chunksCount, best_t(firstGain, 0));
+        m_threads->run(chunksCount, [&](std::size_t chunk) {
+            auto &best = chunksBest[chunk];
+            auto begin = std::max<std::size_t>(moves.size() * chunk / chunksCount, 1);
+            auto end = moves.size() * (chunk + 1) / chunksCount;
+            for (auto i = begin; i < end; ++i) {
+                auto gain = comps.template call<Gain>(solution, moves[i]);
+                if (gain > best.first) {
+                    best = best_t(gain, i);
+                }
+            }
+        });
+
+        // chunks are ordered, so ties are resolved as in max_functor
+        auto maxBest = chunksBest.front();
+        for (auto const &best : chunksBest) {
+            if (best.first > maxBest.first) {
+                maxBest = best;
+            }
+        }
+
+        if (maxBest.first > accumulatorData) {
+            auto commit = std::bind(std::ref(comps.template get<Commit>()),
+                                    std::ref(solution), moves[maxBest.second]);
+            return continuation(commit, maxBest.first);
+        } else {
+            return continuation(accumulatorFunctor, accumulatorData);
+        }
+    }
+
+  private:
+    unsigned m_threads_count;
+    std::unique_ptr<persistent_thread_pool> m_threads;
+};
+
+/**
+ * @brief This strategy chooses the best possible move and if it is improving
+ * applies it to the solution. Gains of the moves are computed by many threads,
+ * see parallel_max_functor for the requirements on Gain.
+ */
+class parallel_best_improving_strategy {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param threads_count
+     */
+    parallel_best_improving_strategy(
+        unsigned threads_count = std::thread::hardware_concurrency())
+        : m_fun(threads_count) {}
+
+    /**
+     * @brief operator()
+     *
+     * @tparam SearchJoin
+     * @param join
+     *
+     * @return
+     */
+    template <typename SearchJoin> bool operator()(SearchJoin &join) const {
+        return m_fold(m_fun, utils::always_false{}, 0, join);
+    }
+
+  private:
+    parallel_max_functor m_fun;
+    data_structures::polymorfic_fold m_fold;
+};
+
+/**
+ * @brief true if the strategy calls Gain concurrently for the same solution
+ *
+ * @tparam SearchStrategy
+ */
+template <typename SearchStrategy>
+struct calls_gain_concurrently : std::false_type {};
+
+/// parallel_best_improving_strategy calls Gain concurrently
+template <>
+struct calls_gain_concurrently<parallel_best_improving_strategy> : std::true_type {};
+
 /**
  * @brief This strategy chooses the best possible move and applies it to the
  * solution.
@@ -284,6 +445,27 @@ bool best_improving(Solution &solution, components... comps) {
                         std::move(comps)...);
 }
 
+/**
+ * @brief This local search chooses the best possible move and if the move is
+* improving applies it to the solution. Gains are computed by threads_count threads,
+* see parallel_max_functor for the requirements on Gain.
+ *
+ * @tparam Solution
+ * @tparam components
+ * @param solution
+ * @param threads_count
+ * @param comps
+ *
+ * @return
+ */
+template <typename Solution, typename... components>
+bool parallel_best_improving(Solution &solution, unsigned threads_count,
+                             components... comps) {
+    return local_search(solution, parallel_best_improving_strategy{threads_count},
+                        utils::always_true{}, utils::always_false{},
+                        std::move(comps)...);
+}
+
 /**
  * @brief This local search chooses the best possible move and applies it to the
 * solution.
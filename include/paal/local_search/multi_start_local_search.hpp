@@ -0,0 +1,263 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file multi_start_local_search.hpp
+ * @brief runs many independent local searches on a thread pool
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_MULTI_START_LOCAL_SEARCH_HPP
+#define PAAL_MULTI_START_LOCAL_SEARCH_HPP
+
+#include "paal/local_search/local_search.hpp"
+#include "paal/data_structures/thread_pool.hpp"
+#include "paal/utils/functors.hpp"
+#include "paal/utils/type_functions.hpp"
+
+#include <boost/optional.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+namespace paal {
+namespace local_search {
+
+/**
+ * @brief The best solution found by a number of concurrent searches,
+ * bigger values are better.
+ * The value is an atomic, so searches compare against it without locking.
+ * The solution is copied under the lock, only when the value improves.
+ *
+ * @tparam Solution
+ * @tparam Value
+ */
+template <typename Solution, typename Value> class shared_best_solution {
+  public:
+    shared_best_solution()
+        : m_value(std::numeric_limits<Value>::lowest()) {}
+
+    /**
+     * @brief the best value so far, lock free
+     *
+     * @return
+     */
+    Value get_value() const { return m_value.load(); }
+
+    /**
+     * @brief stores the solution if its value is better than the best one
+     *
+     * @param solution
+     * @param value
+     *
+     * @return true if the solution was stored
+     */
+    bool update(const Solution &solution, Value value) {
+        auto best = m_value.load();
+        while (best < value || !m_stored.load()) {
+            if (best < value && !m_value.compare_exchange_weak(best, value)) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // other thread could store better solution in the meantime
+            if (m_stored && value <= m_solution_value) {
+                return false;
+            }
+            m_solution = solution;
+            m_solution_value = value;
+            m_stored = true;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief the best solution, should not be called concurrently with update
+     *
+     * @return
+     */
+    const Solution &get_solution() const {
+        assert(m_solution);
+        return *m_solution;
+    }
+
+    /**
+     * @brief value of the stored solution, should not be called concurrently
+     * with update
+     *
+     * @return
+     */
+    Value get_solution_value() const { return m_solution_value; }
+
+  private:
+    std::atomic<Value> m_value;
+    std::atomic<bool> m_stored{ false };
+    std::mutex m_mutex;
+    boost::optional<Solution> m_solution;
+    Value m_solution_value{};
+};
+
+/**
+ * @brief Condition for multi_start_local_search,
+ * stops the search which is worse than the best one by more than the given gap.
+ *
+ * @tparam Value
+ */
+template <typename Value> class stop_condition_behind_best {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param gap
+     */
+    stop_condition_behind_best(Value gap) : m_gap(gap) {}
+
+    /**
+     * @brief operator()
+     *
+     * @param value value of the current solution
+     * @param best the best value found by all searches
+     *
+     * @return true if the search should be stopped
+     */
+    bool operator()(Value value, Value best) const { return value + m_gap < best; }
+
+  private:
+    Value m_gap;
+};
+
+namespace detail {
+
+template <typename SearchStrategy, typename ContinueOnSuccess,
+          typename ContinueOnFail, typename Solution, typename Components>
+bool local_search_with_packs(Solution &solution, SearchStrategy strategy,
+                             ContinueOnSuccess succ, ContinueOnFail fail,
+                             Components comps) {
+    return local_search(solution, std::move(strategy), std::move(succ),
+                        std::move(fail), std::move(comps));
+}
+
+template <typename SearchStrategy, typename ContinueOnSuccess,
+          typename ContinueOnFail, typename Solution, typename... Components,
+          std::size_t... I>
+bool local_search_with_packs(Solution &solution, SearchStrategy strategy,
+                             ContinueOnSuccess succ, ContinueOnFail fail,
+                             std::tuple<Components...> comps,
+                             std::index_sequence<I...>) {
+    return local_search(solution, std::move(strategy), std::move(succ),
+                        std::move(fail), std::get<I>(std::move(comps))...);
+}
+
+template <typename SearchStrategy, typename ContinueOnSuccess,
+          typename ContinueOnFail, typename Solution, typename... Components>
+bool local_search_with_packs(Solution &solution, SearchStrategy strategy,
+                             ContinueOnSuccess succ, ContinueOnFail fail,
+                             std::tuple<Components...> comps) {
+    return local_search_with_packs(solution, std::move(strategy), std::move(succ),
+                                   std::move(fail), std::move(comps),
+                                   std::index_sequence_for<Components...>{});
+}
+
+} //!detail
+
+/**
+ * @brief Runs starts independent local searches on threads_count threads
+ * and returns the best solution found by any of them.
+ *
+ * The search number i starts from solution_factory(i) with components
+ * components_factory(i, best), which returns one search components pack or
+ * a std::tuple of packs. best is a copy of the starting solution
+ * owned by the search, so components may record in it the best solution
+ * of the trajectory (e.g. record_solution_commit_adapter).
+ * Every offer_period steps the current solution is offered to the shared best,
+ * which evaluates the objective and copies the solution if it is the best one.
+ * At the end the current and the recorded solution are offered.
+ *
+ * succ and fail are copied for each search, so stop_condition_time_limit
+ * created before the call is a global time limit for all searches.
+ * The factories are called concurrently from many threads.
+ * When the solution is offered, the search is stopped if
+ * stop_straggler(value, best_value) is true, e.g. stop_condition_behind_best.
+ *
+ * @param starts number of searches
+ * @param solution_factory
+ * @param components_factory
+ * @param objective value of the solution, bigger is better
+ * @param search_strategy
+ * @param succ
+ * @param fail
+ * @param stop_straggler
+ * @param threads_count
+ * @param offer_period number of steps between offers, smaller period stops
+ *        stragglers earlier at the cost of more objective evaluations
+ *
+ * @return the best solution and its value
+ */
+template <typename SolutionFactory, typename ComponentsFactory,
+          typename Objective, typename SearchStrategy,
+          typename ContinueOnSuccess, typename ContinueOnFail,
+          typename StopStraggler = utils::always_false>
+auto multi_start_local_search(
+    std::size_t starts, SolutionFactory solution_factory,
+    ComponentsFactory components_factory, Objective objective,
+    SearchStrategy search_strategy, ContinueOnSuccess succ, ContinueOnFail fail,
+    StopStraggler stop_straggler = StopStraggler{},
+    unsigned threads_count = std::thread::hardware_concurrency(),
+    std::size_t offer_period = 16) {
+    using solution_t = puretype(solution_factory(std::size_t{}));
+    using value_t = puretype(objective(std::declval<const solution_t &>()));
+    assert(starts > 0);
+    assert(offer_period > 0);
+
+    shared_best_solution<solution_t, value_t> best;
+    // offers the solution to the shared best,
+    // returns true if the search should be continued
+    auto offer = [&](const solution_t &solution) {
+        auto value = objective(solution);
+        best.update(solution, value);
+        return !stop_straggler(value, best.get_value());
+    };
+
+    thread_pool threads(std::max(1u, std::min<unsigned>(threads_count, starts)));
+    for (std::size_t i = 0; i < starts; ++i) {
+        threads.post([&, i]() {
+            auto solution = solution_factory(i);
+            auto recorded = solution;
+            std::size_t steps = 0;
+            auto offer_periodically = [&](const solution_t &s) {
+                return ++steps % offer_period != 0 || offer(s);
+            };
+            auto on_success = [&, succ](solution_t &s) mutable {
+                return offer_periodically(s) && succ(s);
+            };
+            auto on_fail = [&, fail](solution_t &s) mutable {
+                return offer_periodically(s) && fail(s);
+            };
+            detail::local_search_with_packs(solution, search_strategy,
+                                            std::move(on_success),
+                                            std::move(on_fail),
+                                            components_factory(i, recorded));
+            offer(solution);
+            offer(recorded);
+        });
+    }
+    threads.run();
+
+    return std::make_pair(best.get_solution(), best.get_solution_value());
+}
+
+} // local_search
+} // paal
+
+#endif // PAAL_MULTI_START_LOCAL_SEARCH_HPP
@@ -20,6 +20,10 @@
 #include <boost/iterator/function_input_iterator.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <memory>
+#include <random>
+#include <vector>
+
 namespace paal {
 namespace local_search {
 
@@ -158,6 +162,174 @@ struct n_queens_gain {
                2 * (std::abs(x1 - x2) == std::abs(y1 - y2));
     }
 };
+/**
+ * @brief get_moves sampling only queens in conflict.
+ * It keeps list of candidates such that every pair of attacking queens
+ * has a queen in the list. Candidate is chosen randomly, if it is not
+ * in conflict it is removed from the list and the next one is chosen.
+ * The moves are swaps of the candidate with samples random queens.
+ * Must be used with n_queens_conflicts_commit.
+ * Copies share the state. The list is rebuilt when the size of the solution
+ * changes and before reporting that there are no conflicts, so the same
+ * instance can be reused for other solutions or after a restart.
+ *
+ * @tparam RandomGenerator
+ */
+template <typename RandomGenerator = std::default_random_engine>
+class n_queens_conflicts_get_moves {
+    struct state {
+        state(int samples, RandomGenerator rand)
+            : m_samples(samples), m_rand(std::move(rand)) {}
+
+        int m_samples;
+        RandomGenerator m_rand;
+        std::vector<int> m_candidates;
+        std::vector<bool> m_is_candidate;
+        std::vector<Move> m_moves;
+    };
+
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param samples number of moves for chosen queen
+     * @param rand
+     */
+    n_queens_conflicts_get_moves(int samples = 32,
+                                 RandomGenerator rand = RandomGenerator())
+        : m_state(std::make_shared<state>(samples, std::move(rand))) {}
+
+    /**
+     * @brief operator(), moves of random queen in conflict,
+     * empty range if there are no conflicts
+     *
+     * @tparam Solution
+     * @param solution
+     *
+     * @return
+     */
+    template <typename Solution>
+    const std::vector<Move> &operator()(const Solution &solution) const {
+        auto &s = *m_state;
+        init(solution);
+        s.m_moves.clear();
+        bool rebuilt = false;
+        while (true) {
+            if (s.m_candidates.empty()) {
+                // the solution might have been changed outside of the search
+                if (rebuilt) break;
+                rebuild(solution);
+                rebuilt = true;
+                continue;
+            }
+            std::uniform_int_distribution<std::size_t> candidate(
+                0, s.m_candidates.size() - 1);
+            auto i = candidate(s.m_rand);
+            int x = s.m_candidates[i];
+            if (!solution.is_in_conflict(x)) {
+                s.m_is_candidate[x] = false;
+                s.m_candidates[i] = s.m_candidates.back();
+                s.m_candidates.pop_back();
+                continue;
+            }
+            std::uniform_int_distribution<int> queen(0, size(solution) - 1);
+            for (int j = 0; j < s.m_samples; ++j) {
+                int y = queen(s.m_rand);
+                if (y != x) {
+                    s.m_moves.emplace_back(x, y);
+                }
+            }
+            break;
+        }
+        return s.m_moves;
+    }
+
+    /**
+     * @brief adds the xth queen to candidates if it is in conflict
+     *
+     * @tparam Solution
+     * @param solution
+     * @param x
+     */
+    template <typename Solution>
+    void add_candidate(const Solution &solution, int x) const {
+        auto &s = *m_state;
+        init(solution);
+        if (!s.m_is_candidate[x] && solution.is_in_conflict(x)) {
+            s.m_is_candidate[x] = true;
+            s.m_candidates.push_back(x);
+        }
+    }
+
+    /**
+     * @brief upper bound on the number of queens in conflict,
+     * 0 means there are no conflicts (after the first call)
+     *
+     * @return
+     */
+    std::size_t candidates_count() const { return m_state->m_candidates.size(); }
+
+  private:
+    template <typename Solution> static int size(const Solution &solution) {
+        return solution.end() - solution.begin();
+    }
+
+    template <typename Solution> void init(const Solution &solution) const {
+        if (m_state->m_is_candidate.size() != std::size_t(size(solution))) {
+            rebuild(solution);
+        }
+    }
+
+    template <typename Solution> void rebuild(const Solution &solution) const {
+        auto &s = *m_state;
+        s.m_candidates.clear();
+        s.m_is_candidate.assign(size(solution), false);
+        for (int x = 0; x < size(solution); ++x) {
+            if (solution.is_in_conflict(x)) {
+                s.m_is_candidate[x] = true;
+                s.m_candidates.push_back(x);
+            }
+        }
+    }
+
+    std::shared_ptr<state> m_state;
+};
+
+/**
+ * @brief commit for n_queens_conflicts_get_moves,
+ * swaps queens and updates candidates
+ *
+ * @tparam GetMoves
+ */
+template <typename GetMoves> struct n_queens_conflicts_commit {
+    /**
+     * @brief constructor
+     *
+     * @param get_moves
+     */
+    n_queens_conflicts_commit(GetMoves get_moves)
+        : m_get_moves(std::move(get_moves)) {}
+
+    /**
+     * @brief operator()
+     *
+     * @tparam Solution
+     * @param sol
+     * @param move
+     *
+     * @return
+     */
+    template <typename Solution> bool operator()(Solution &sol, Move move) const {
+        sol.swap_queens(move.get_from(), move.get_to());
+        m_get_moves.add_candidate(sol, move.get_from());
+        m_get_moves.add_candidate(sol, move.get_to());
+        return true;
+    }
+
+  private:
+    GetMoves m_get_moves;
+};
+
 } //!local_search
 } //!paal
 
@@ -82,6 +82,25 @@ void n_queens_solution_first_improving(NQueensPositionsVector &pos,
                                    std::move(nQueenscomponents)...);
 }
 
+/**
+ * @brief components sampling only queens in conflict,
+ * see n_queens_conflicts_get_moves
+ *
+ * @tparam RandomGenerator
+ * @param samples
+ * @param rand
+ *
+ * @return
+ */
+template <typename RandomGenerator = std::default_random_engine>
+auto make_n_queens_conflicts_components(int samples = 32,
+                                        RandomGenerator rand = RandomGenerator()) {
+    n_queens_conflicts_get_moves<RandomGenerator> get_moves(samples, std::move(rand));
+    n_queens_conflicts_commit<decltype(get_moves)> commit(get_moves);
+    return make_search_components(std::move(get_moves), n_queens_gain{},
+                                  std::move(commit));
+}
+
 } //!local_search
 } // !paal
 
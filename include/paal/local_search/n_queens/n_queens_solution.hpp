@@ -21,6 +21,9 @@
 #include <boost/range/iterator_range.hpp>
 #include <boost/range/numeric.hpp>
 
+#include <cassert>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 namespace paal {
@@ -31,8 +34,12 @@ namespace local_search {
  * able to efficiently compute gain of given move
  *
  * @tparam NQueensPositionsVector
+ * @tparam Counter type of the diagonal counters, compact type (e.g. uint16_t)
+ *         saves memory for large n, but the number of queens on one diagonal
+ *         must fit in it (it does not for the identity permutation)
  */
-template <typename NQueensPositionsVector> struct n_queens_solution_adapter {
+template <typename NQueensPositionsVector, typename Counter = int>
+struct n_queens_solution_adapter {
     typedef typename boost::counting_iterator<int> QueensIterator;
 
     /**
@@ -99,6 +106,19 @@ template <typename NQueensPositionsVector> struct n_queens_solution_adapter {
      */
     int get_y(int x) const { return m_queen_position[x]; }
 
+    /**
+     * @brief checks if the xth queen is attacked by other queen
+     *
+     * @param x
+     *
+     * @return
+     */
+    bool is_in_conflict(int x) const {
+        int y = m_queen_position[x];
+        return m_numeber_attacing_counter_diagonal[x + y] > 1 ||
+               get_diagonal(x, y) > 1;
+    }
+
     /**
      * @brief computes total number of conflicts on the board
      *
@@ -135,7 +155,7 @@ template <typename NQueensPositionsVector> struct n_queens_solution_adapter {
      *
      * @return
      */
-    int &get_diagonal(int x) { return get_diagonal(x, m_queen_position[x]); }
+    Counter &get_diagonal(int x) { return get_diagonal(x, m_queen_position[x]); }
 
     /**
      * @brief gets diagonal crossing (x,y) position
@@ -145,7 +165,7 @@ template <typename NQueensPositionsVector> struct n_queens_solution_adapter {
      *
      * @return
      */
-    int &get_diagonal(int x, int y) {
+    Counter &get_diagonal(int x, int y) {
         if (x >= y) {
             return m_numeber_attacing_diagonal_negative[x - y];
         } else {
@@ -185,16 +205,36 @@ template <typename NQueensPositionsVector> struct n_queens_solution_adapter {
      * @param x
      */
     void increase(int x) {
-        ++m_numeber_attacing_counter_diagonal[x + m_queen_position[x]];
-        ++get_diagonal(x);
+        increment(m_numeber_attacing_counter_diagonal[x + m_queen_position[x]]);
+        increment(get_diagonal(x));
+    }
+
+    /**
+     * @brief increments counter checking overflow
+     *
+     * @param counter
+     */
+    static void increment(Counter &counter) {
+        assert(counter < std::numeric_limits<Counter>::max());
+        ++counter;
     }
 
     NQueensPositionsVector &m_queen_position;
-    std::vector<int> m_numeber_attacing_diagonal_negative;
-    std::vector<int> m_numeber_attacing_diagonal_nonnegative;
-    std::vector<int> m_numeber_attacing_counter_diagonal;
+    std::vector<Counter> m_numeber_attacing_diagonal_negative;
+    std::vector<Counter> m_numeber_attacing_diagonal_nonnegative;
+    std::vector<Counter> m_numeber_attacing_counter_diagonal;
 };
 
+/**
+ * @brief n_queens_solution_adapter with 16 bit diagonal counters,
+ * start from a random permutation
+ *
+ * @tparam NQueensPositionsVector
+ */
+template <typename NQueensPositionsVector>
+using n_queens_compact_solution_adapter =
+    n_queens_solution_adapter<NQueensPositionsVector, std::uint16_t>;
+
 } //!local_search
 } //!paal
 
@@ -0,0 +1,204 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file parallel_tempering.hpp
+ * @brief simulated annealing replicas at different temperatures exchanging
+ * their temperatures (replica exchange)
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_PARALLEL_TEMPERING_HPP
+#define PAAL_PARALLEL_TEMPERING_HPP
+
+#include "paal/local_search/multi_start_local_search.hpp"
+#include "paal/local_search/simulated_annealing.hpp"
+#include "paal/data_structures/thread_pool.hpp"
+#include "paal/utils/type_functions.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace paal {
+namespace local_search {
+
+/**
+ * @brief temperatures from min_temperature to max_temperature
+ * forming geometric sequence, typical ladder for parallel_tempering
+ *
+ * @param min_temperature
+ * @param max_temperature
+ * @param count
+ *
+ * @return
+ */
+inline std::vector<double> geometric_temperatures(double min_temperature,
+                                                  double max_temperature,
+                                                  std::size_t count) {
+    assert(min_temperature > 0 && min_temperature <= max_temperature);
+    assert(count > 0);
+    std::vector<double> temperatures(count, min_temperature);
+    if (count > 1) {
+        auto ratio = std::pow(max_temperature / min_temperature, 1. / (count - 1));
+        for (std::size_t i = 1; i < count; ++i) {
+            temperatures[i] = temperatures[i - 1] * ratio;
+        }
+    }
+    return temperatures;
+}
+
+namespace detail {
+
+/// threads wait until all of them arrive, the last one performs the action
+class barrier {
+  public:
+    barrier(std::size_t count) : m_count(count) {}
+
+    template <typename Action> void arrive_and_wait(Action &&action) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto generation = m_generation;
+        if (++m_arrived == m_count) {
+            action();
+            m_arrived = 0;
+            ++m_generation;
+            m_condition.notify_all();
+        } else {
+            m_condition.wait(lock, [&]() { return generation != m_generation; });
+        }
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::size_t m_count;
+    std::size_t m_arrived = 0;
+    std::size_t m_generation = 0;
+};
+
+} //!detail
+
+/**
+ * @brief Parallel tempering (replica exchange).
+ * Replica number i starts from solution_factory(i) at temperature
+ * temperatures[i] and runs on its own thread. Every steps_between_exchanges
+ * steps all replicas stop and replicas at adjacent temperatures
+ * (even pairs and odd pairs in turns) exchange their temperatures
+ * with the Metropolis probability
+ * min(1, e^((value_b - value_a) * (1 / t_a - 1 / t_b))).
+ * The search ends when stop(), checked at each exchange, returns true,
+ * e.g. stop_condition_time_limit or stop_condition_count_limit.
+ *
+ * components_factory(i, best, get_temperature) returns one search components
+ * pack or a std::tuple of packs for the replica i.
+ * get_temperature is a functor returning the current temperature of the
+ * replica, it should be passed to simulated_annealing_gain_adaptor
+ * or simulated_annealing_commit_adaptor.
+ * best is owned by the replica, components may record in it the best
+ * solution of the replica (e.g. record_solution_commit_adapter).
+ * The factories are called concurrently from many threads.
+ *
+ * @param solution_factory
+ * @param temperatures positive temperatures, e.g. geometric_temperatures
+ * @param components_factory
+ * @param objective value of the solution, bigger is better
+ * @param search_strategy
+ * @param stop
+ * @param steps_between_exchanges
+ * @param rand
+ *
+ * @return the best solution and its value
+ */
+template <typename SolutionFactory, typename ComponentsFactory,
+          typename Objective, typename SearchStrategy, typename StopCondition,
+          typename RandomGenerator = std::default_random_engine>
+auto parallel_tempering(SolutionFactory solution_factory,
+                        std::vector<double> temperatures,
+                        ComponentsFactory components_factory,
+                        Objective objective, SearchStrategy search_strategy,
+                        StopCondition stop,
+                        std::size_t steps_between_exchanges = 100,
+                        RandomGenerator rand = RandomGenerator()) {
+    using solution_t = puretype(solution_factory(std::size_t{}));
+    using value_t = puretype(objective(std::declval<const solution_t &>()));
+    auto const replicas = temperatures.size();
+    assert(replicas > 0);
+    assert(steps_between_exchanges > 0);
+
+    // solutions are set by the replicas, they are read during the exchange
+    // when all replicas wait
+    std::vector<const solution_t *> solutions(replicas);
+    // replica_at[l] is the replica with temperature on the position l
+    // of the ladder
+    std::vector<std::size_t> replica_at(replicas);
+    for (std::size_t i = 0; i < replicas; ++i) {
+        assert(temperatures[i] > 0);
+        replica_at[i] = i;
+    }
+    auto replica_temperatures = temperatures;
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    bool odd_pairs = false;
+    bool finished = false;
+
+    auto exchange = [&]() {
+        if (stop()) {
+            finished = true;
+            return;
+        }
+        for (std::size_t l = odd_pairs; l + 1 < replicas; l += 2) {
+            auto a = replica_at[l];
+            auto b = replica_at[l + 1];
+            auto &t_a = replica_temperatures[a];
+            auto &t_b = replica_temperatures[b];
+            double delta = objective(*solutions[b]) - objective(*solutions[a]);
+            if (distribution(rand) < std::exp(delta * (1. / t_a - 1. / t_b))) {
+                std::swap(t_a, t_b);
+                std::swap(replica_at[l], replica_at[l + 1]);
+            }
+        }
+        odd_pairs = !odd_pairs;
+    };
+
+    shared_best_solution<solution_t, value_t> best;
+    detail::barrier sync(replicas);
+    thread_pool threads(replicas);
+    for (std::size_t i = 0; i < replicas; ++i) {
+        threads.post([&, i]() {
+            auto solution = solution_factory(i);
+            auto recorded = solution;
+            solutions[i] = &solution;
+            std::size_t steps = 0;
+            auto step = [&](solution_t &) {
+                if (++steps < steps_between_exchanges) {
+                    return true;
+                }
+                steps = 0;
+                sync.arrive_and_wait(exchange);
+                return !finished;
+            };
+            auto get_temperature = [&t = replica_temperatures[i]]() { return t; };
+            detail::local_search_with_packs(
+                solution, search_strategy, step, step,
+                components_factory(i, recorded, get_temperature));
+            best.update(solution, objective(solution));
+            best.update(recorded, objective(recorded));
+        });
+    }
+    threads.run();
+
+    return std::make_pair(best.get_solution(), best.get_solution_value());
+}
+
+} //!local_search
+} //!paal
+
+#endif // PAAL_PARALLEL_TEMPERING_HPP
@@ -0,0 +1,445 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file search_statistics.hpp
+ * @brief opt-in instrumentation of search components: number of moves,
+ * time spent in the components and improvements, exported as JSON or CSV
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_SEARCH_STATISTICS_HPP
+#define PAAL_SEARCH_STATISTICS_HPP
+
+#include "paal/local_search/local_search.hpp"
+#include "paal/local_search/search_components.hpp"
+#include "paal/utils/type_functions.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace paal {
+namespace local_search {
+
+/**
+ * @brief statistics of one successful commit
+ */
+struct iteration_statistics {
+    /// time from the start of the statistics
+    double seconds;
+    /// moves evaluated since the previous commit
+    std::size_t moves_evaluated;
+    /// gain of the committed move
+    double gain;
+};
+
+/**
+ * @brief Statistics of one search components pack,
+ * filled by the components created by make_instrumented_components.
+ * The statistics are not synchronized, so the components should not be
+ * used with parallel_best_improving_strategy.
+ */
+struct search_statistics {
+    /// clock used for measurements
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * @brief constructor
+     *
+     * @param name name of the components pack, used in the export
+     */
+    explicit search_statistics(std::string name = "")
+        : name(std::move(name)), start(clock::now()) {}
+
+    /**
+     * @brief improvement per second of the search
+     * (to the last successful commit)
+     *
+     * @return
+     */
+    double improvement_per_second() const {
+        if (iterations.empty() || iterations.back().seconds == 0) {
+            return 0;
+        }
+        return improvement / iterations.back().seconds;
+    }
+
+    /// name of the components pack
+    std::string name;
+    /// start of the measurements
+    clock::time_point start;
+    /// number of GetMoves calls
+    std::size_t get_moves_calls = 0;
+    /// number of Gain calls
+    std::size_t moves_evaluated = 0;
+    /// number of moves with positive gain
+    std::size_t improving_moves = 0;
+    /// number of successful commits
+    std::size_t commits = 0;
+    /// time spent in GetMoves (creation of the range)
+    double get_moves_seconds = 0;
+    /// time spent in Gain
+    double gain_seconds = 0;
+    /// time spent in Commit
+    double commit_seconds = 0;
+    /// sum of the gains of the committed moves
+    double improvement = 0;
+    /// statistics of successive commits
+    std::vector<iteration_statistics> iterations;
+};
+
+namespace detail {
+
+/// adds the time of its life to the given counter
+class scoped_timer {
+  public:
+    scoped_timer(double &seconds)
+        : m_seconds(seconds), m_begin(search_statistics::clock::now()) {}
+
+    ~scoped_timer() {
+        m_seconds += std::chrono::duration<double>(
+                         search_statistics::clock::now() - m_begin).count();
+    }
+
+  private:
+    double &m_seconds;
+    search_statistics::clock::time_point m_begin;
+};
+
+/// gain as (chosen, value), ordered as the gains of the local search
+template <typename Delta>
+auto gain_rank(const Delta &delta, int)
+    -> decltype(std::make_pair(bool(delta.chosen()), double(delta.delta()))) {
+    return std::make_pair(bool(delta.chosen()), double(delta.delta()));
+}
+
+template <typename Delta>
+std::pair<bool, double> gain_rank(const Delta &delta, long) {
+    return std::make_pair(true, double(delta));
+}
+
+/**
+ * @brief the largest gain evaluated since the last GetMoves call,
+ * it is the gain of the move chosen by the search strategy.
+ * Shared by instrumented_gain and instrumented_commit.
+ */
+struct step_gain {
+    /// get_moves_calls when the gain was evaluated
+    std::size_t step = 0;
+    /// if the gain was evaluated
+    bool valid = false;
+    /// gain as returned by gain_rank
+    std::pair<bool, double> rank;
+};
+
+} //!detail
+
+/**
+ * @brief GetMoves counting the calls and measuring time
+ *
+ * @tparam GetMoves
+ */
+template <typename GetMoves> class instrumented_get_moves {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param get_moves
+     * @param statistics
+     */
+    instrumented_get_moves(GetMoves get_moves, search_statistics &statistics)
+        : m_get_moves(std::move(get_moves)), m_statistics(&statistics) {}
+
+    /**
+     * @brief operator()
+     *
+     * @tparam Args
+     * @param args
+     *
+     * @return
+     */
+    template <typename... Args>
+    auto operator()(Args &&... args)
+        -> decltype(std::declval<GetMoves &>()(std::forward<Args>(args)...)) {
+        ++m_statistics->get_moves_calls;
+        detail::scoped_timer timer(m_statistics->get_moves_seconds);
+        return m_get_moves(std::forward<Args>(args)...);
+    }
+
+  private:
+    GetMoves m_get_moves;
+    search_statistics *m_statistics;
+};
+
+/**
+ * @brief Gain counting evaluated and improving moves and measuring time
+ *
+ * @tparam Gain
+ */
+template <typename Gain> class instrumented_gain {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param gain
+     * @param statistics
+     */
+    instrumented_gain(Gain gain, search_statistics &statistics,
+                      std::shared_ptr<detail::step_gain> step_gain)
+        : m_gain(std::move(gain)), m_statistics(&statistics),
+          m_step_gain(std::move(step_gain)) {}
+
+    /**
+     * @brief operator()
+     *
+     * @tparam Args
+     * @param args
+     *
+     * @return
+     */
+    template <typename... Args>
+    auto operator()(Args &&... args)
+        -> decltype(std::declval<Gain &>()(std::forward<Args>(args)...)) {
+        ++m_statistics->moves_evaluated;
+        auto delta = [&]() {
+            detail::scoped_timer timer(m_statistics->gain_seconds);
+            return m_gain(std::forward<Args>(args)...);
+        }();
+        if (detail::positive_delta(delta)) {
+            ++m_statistics->improving_moves;
+        }
+        auto rank = detail::gain_rank(delta, 0);
+        auto &step_gain = *m_step_gain;
+        if (!step_gain.valid ||
+            step_gain.step != m_statistics->get_moves_calls ||
+            rank > step_gain.rank) {
+            step_gain.step = m_statistics->get_moves_calls;
+            step_gain.valid = true;
+            step_gain.rank = rank;
+        }
+        return delta;
+    }
+
+  private:
+    Gain m_gain;
+    search_statistics *m_statistics;
+    std::shared_ptr<detail::step_gain> m_step_gain;
+};
+
+/**
+ * @brief Commit measuring time and recording the successful commits.
+ * The gain of the committed move is the largest gain evaluated by
+ * instrumented_gain in the current step, i.e. the gain of the move chosen
+ * by first_improving_strategy or best_improving_strategy,
+ * Gain is not called again.
+ *
+ * @tparam Commit
+ */
+template <typename Commit> class instrumented_commit {
+  public:
+    /**
+     * @brief constructor
+     *
+     * @param commit
+     * @param statistics
+     * @param step_gain
+     */
+    instrumented_commit(Commit commit, search_statistics &statistics,
+                        std::shared_ptr<detail::step_gain> step_gain)
+        : m_commit(std::move(commit)), m_statistics(&statistics),
+          m_step_gain(std::move(step_gain)) {}
+
+    /**
+     * @brief operator()
+     *
+     * @tparam Solution
+     * @tparam Move
+     * @param solution
+     * @param move
+     *
+     * @return
+     */
+    template <typename Solution, typename Move>
+    bool operator()(Solution &solution, const Move &move) {
+        auto &step_gain = *m_step_gain;
+        double delta = step_gain.valid &&
+                               step_gain.step == m_statistics->get_moves_calls
+                           ? step_gain.rank.second
+                           : 0;
+        step_gain.valid = false;
+        bool ret = [&]() {
+            detail::scoped_timer timer(m_statistics->commit_seconds);
+            return m_commit(solution, move);
+        }();
+        if (ret) {
+            auto &s = *m_statistics;
+            ++s.commits;
+            s.improvement += delta;
+            s.iterations.push_back(iteration_statistics{
+                std::chrono::duration<double>(search_statistics::clock::now() -
+                                              s.start).count(),
+                s.moves_evaluated - m_moves_evaluated, delta });
+            m_moves_evaluated = s.moves_evaluated;
+        }
+        return ret;
+    }
+
+  private:
+    Commit m_commit;
+    search_statistics *m_statistics;
+    std::shared_ptr<detail::step_gain> m_step_gain;
+    std::size_t m_moves_evaluated = 0;
+};
+
+/**
+ * @brief Wraps components of the pack so that they fill statistics.
+ * Gain of the committed moves is the gain evaluated by the search,
+ * for simulated_annealing_gain_adaptor it is the original gain of the move.
+ * Components which are not wrapped cost nothing.
+ *
+ * @tparam Components
+ * @param components
+ * @param statistics
+ *
+ * @return
+ */
+template <typename Components>
+auto make_instrumented_components(const Components &components,
+                                  search_statistics &statistics) {
+    using get_moves_t = puretype(components.template get<GetMoves>());
+    using gain_t = puretype(components.template get<Gain>());
+    using commit_t = puretype(components.template get<Commit>());
+    auto step_gain = std::make_shared<detail::step_gain>();
+    return make_search_components(
+        instrumented_get_moves<get_moves_t>(components.template get<GetMoves>(),
+                                            statistics),
+        instrumented_gain<gain_t>(components.template get<Gain>(), statistics,
+                                  step_gain),
+        instrumented_commit<commit_t>(components.template get<Commit>(),
+                                      statistics, step_gain));
+}
+
+namespace detail {
+
+inline void write_json_string(std::ostream &out, const std::string &str) {
+    out << '"';
+    for (auto c : str) {
+        switch (c) {
+        case '"':
+            out << "\\\"";
+            break;
+        case '\\':
+            out << "\\\\";
+            break;
+        case '\n':
+            out << "\\n";
+            break;
+        case '\r':
+            out << "\\r";
+            break;
+        case '\t':
+            out << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char code[7];
+                std::snprintf(code, sizeof(code), "\\u%04x",
+                              static_cast<unsigned>(c));
+                out << code;
+            } else {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+
+/// quotes the field if it contains a separator, a quote or a line break
+inline void write_csv_string(std::ostream &out, const std::string &str) {
+    if (str.find_first_of(",\"\r\n") == std::string::npos) {
+        out << str;
+        return;
+    }
+    out << '"';
+    for (auto c : str) {
+        if (c == '"') {
+            out << '"';
+        }
+        out << c;
+    }
+    out << '"';
+}
+
+} //!detail
+
+/**
+ * @brief writes statistics as JSON array, one object per components pack
+ *
+ * @tparam StatisticsRange
+ * @param out
+ * @param statistics range of search_statistics
+ */
+template <typename StatisticsRange>
+void write_statistics_json(std::ostream &out, const StatisticsRange &statistics) {
+    out << "[";
+    bool first = true;
+    for (const search_statistics &s : statistics) {
+        out << (first ? "" : ",") << "\n  {\"name\": ";
+        first = false;
+        detail::write_json_string(out, s.name);
+        out << ", \"get_moves_calls\": " << s.get_moves_calls
+            << ", \"moves_evaluated\": " << s.moves_evaluated
+            << ", \"improving_moves\": " << s.improving_moves
+            << ", \"commits\": " << s.commits
+            << ", \"get_moves_seconds\": " << s.get_moves_seconds
+            << ", \"gain_seconds\": " << s.gain_seconds
+            << ", \"commit_seconds\": " << s.commit_seconds
+            << ", \"improvement\": " << s.improvement
+            << ", \"improvement_per_second\": " << s.improvement_per_second()
+            << ",\n   \"iterations\": [";
+        for (std::size_t i = 0; i < s.iterations.size(); ++i) {
+            auto const &it = s.iterations[i];
+            out << (i ? ", " : "") << "{\"seconds\": " << it.seconds
+                << ", \"moves_evaluated\": " << it.moves_evaluated
+                << ", \"gain\": " << it.gain << "}";
+        }
+        out << "]}";
+    }
+    out << "\n]\n";
+}
+
+/**
+ * @brief writes statistics of iterations as CSV,
+ * one row per successful commit
+ *
+ * @tparam StatisticsRange
+ * @param out
+ * @param statistics range of search_statistics
+ */
+template <typename StatisticsRange>
+void write_statistics_csv(std::ostream &out, const StatisticsRange &statistics) {
+    out << "name,iteration,seconds,moves_evaluated,gain\n";
+    for (const search_statistics &s : statistics) {
+        for (std::size_t i = 0; i < s.iterations.size(); ++i) {
+            auto const &it = s.iterations[i];
+            detail::write_csv_string(out, s.name);
+            out << "," << i << "," << it.seconds << ","
+                << it.moves_evaluated << "," << it.gain << "\n";
+        }
+    }
+}
+
+} //!local_search
+} //!paal
+
+#endif // PAAL_SEARCH_STATISTICS_HPP
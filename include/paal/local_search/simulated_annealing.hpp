@@ -323,7 +323,7 @@ struct simulated_annealing_gain_adaptor {
             return m_is_chosen;
         }
         ///delta
-        bool delta() const {
+        Delta delta() const {
             return m_delta;
         }
 
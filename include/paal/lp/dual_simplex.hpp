@@ -0,0 +1,1201 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file dual_simplex.hpp
+ * @brief header-only LP implementation (bounded dual simplex with warm start)
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_DUAL_SIMPLEX_HPP
+#define PAAL_DUAL_SIMPLEX_HPP
+
+#include "paal/data_structures/bimap.hpp"
+#include "paal/lp/constraints.hpp"
+#include "paal/lp/ids.hpp"
+#include "paal/lp/lp_base.hpp"
+#include "paal/lp/problem_type.hpp"
+#include "paal/lp/solve_statistics.hpp"
+#include "paal/utils/irange.hpp"
+
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace paal {
+namespace lp {
+
+namespace detail {
+
+/**
+ * @class dual_simplex_impl
+ * @brief LP implementation without external dependencies: the bounded dual
+ * simplex method, falling back to the primal simplex method (with the sum
+ * of infeasibilities in the first phase), when the basis is not dual feasible.
+ *
+ * The instances share no state, so they can be used by many threads at once
+ * (one instance per thread). The constraint matrix is kept sparse,
+ * the basis inverse is kept in the product form (a sequence of elementary
+ * matrices, one per pivot), which is recomputed every REFACTOR_FREQUENCY
+ * pivots. The dual simplex prices the rows with the dual steepest edge
+ * weights, updated in every pivot.
+ *
+ * As in GLPK, every row has an auxiliary variable equal to the row sum
+ * and bounded by the row bounds. The basis (statuses of the variables)
+ * is kept between the runs, resolve_simplex starts from it. The rows added
+ * since the previous run have basic auxiliary variables, the columns are non
+ * basic, so the basis stays dual feasible and the dual simplex can continue.
+ * If the basis is not valid after deletions, it is completed with auxiliary
+ * variables.
+ */
+class dual_simplex_impl {
+    using ColEntries = std::vector<std::pair<row_id, double>>;
+    using RowEntries = std::vector<std::pair<col_id, double>>;
+    using RowsInColumnIterator = ColEntries::const_iterator;
+    /// positions of the entries by the row / column IDs
+    using EntriesIndex = std::unordered_map<int, std::size_t>;
+
+    /// status of a variable in the basis
+    enum var_status {
+        BASIC,
+        AT_LOWER,
+        AT_UPPER,
+        /// non basic free variable, equal to 0
+        FREE,
+        FIXED
+    };
+
+    struct column {
+        double cost_coef;
+        double lb;
+        double ub;
+        ColEntries rows;
+        double value;
+        var_status status;
+        EntriesIndex index;
+    };
+
+    struct row {
+        double lb;
+        double ub;
+        RowEntries cols;
+        double dual;
+        var_status status;
+        EntriesIndex index;
+    };
+
+  public:
+    /**
+     * Constructor.
+     */
+    dual_simplex_impl()
+        : m_total_col_nr(0), m_total_row_nr(0), m_sign(1) {}
+
+    /**
+     * There are no resources common for all LP instances,
+     * the method is provided for the compatibility with glp.
+     */
+    static void free_env() {}
+
+    /**
+     * Sets the problem optimization type (min/max).
+     */
+    void set_optimization_type(optimization_type opt_type) {
+        m_sign = opt_type == MINIMIZE ? 1 : -1;
+    }
+
+    /**
+     * Adds a new column to the LP.
+     *
+     * @param cost_coef coefficient of the column in the objective function
+     * @param lb column lower bound value
+     * @param ub column upper bound value
+     *
+     * @return column identifier
+     */
+    col_id add_column(double cost_coef, double lb, double ub) {
+        m_cols.push_back(column{ cost_coef, lb, ub, {}, 0, AT_LOWER, {} });
+        m_col_idx.add(m_total_col_nr);
+        return col_id(m_total_col_nr++);
+    }
+
+    /**
+     * Adds a new row to the LP.
+     *
+     * @param constraint constraint being added
+     *
+     * @return row identifier
+     */
+    row_id add_row(const double_bounded_expression &constraint) {
+        m_rows.push_back(row{ constraint.get_lower_bound(),
+                              constraint.get_upper_bound(), {}, 0, BASIC, {} });
+        m_row_idx.add(m_total_row_nr);
+        row_id row(m_total_row_nr++);
+        auto expr = constraint.get_expression();
+        for (auto elem : expr.get_elements()) {
+            add_coefficient(row, elem.first, elem.second);
+        }
+        return row;
+    }
+
+    /**
+     * Stages a new column. The columns are added immediately, as there is
+     * no external library to call.
+     */
+    col_id stage_column(double cost_coef, double lb, double ub) {
+        return add_column(cost_coef, lb, ub);
+    }
+
+    /**
+     * Stages a new row. The rows are added immediately, as there is
+     * no external library to call.
+     */
+    row_id stage_row(const double_bounded_expression &constraint) {
+        return add_row(constraint);
+    }
+
+    /**
+     * Adds a coefficient of the constraint matrix, coefficients added many
+     * times for the same row and column are summed.
+     */
+    void stage_coefficient(row_id row, col_id col, double coef) {
+        add_coefficient(row, col, coef);
+    }
+
+    /**
+     * Does nothing, the staged columns and rows are already in the LP.
+     */
+    void load_staged() {}
+
+    /**
+     * Sets the lower bound of an existing LP column.
+     */
+    void set_col_lower_bound(col_id col, double lb) { get(col).lb = lb; }
+
+    /**
+     * Sets the upper bound of an existing LP column.
+     */
+    void set_col_upper_bound(col_id col, double ub) { get(col).ub = ub; }
+
+    /**
+     * Sets the cost coefficient of an existing LP column.
+     */
+    void set_col_cost(col_id col, double cost_coef) {
+        get(col).cost_coef = cost_coef;
+    }
+
+    /**
+     * Sets the lower bound of an existing LP row.
+     */
+    void set_row_lower_bound(row_id row, double lb) { get(row).lb = lb; }
+
+    /**
+     * Sets the upper bound of an existing LP row.
+     */
+    void set_row_upper_bound(row_id row, double ub) { get(row).ub = ub; }
+
+    /**
+     * Sets the linear expression of an existing LP row.
+     */
+    void set_row_expression(row_id row, const linear_expression &expr) {
+        for (auto const &elem : get(row).cols) {
+            auto &col = get(elem.first);
+            erase_entry(col.rows, col.index, row);
+        }
+        get(row).cols.clear();
+        get(row).index.clear();
+        for (auto elem : expr.get_elements()) {
+            add_coefficient(row, elem.first, elem.second);
+        }
+    }
+
+    /**
+     * Removes a column form the LP.
+     *
+     * @param col ID of the column to be removed
+     */
+    void delete_col(col_id col) { delete_cols(std::vector<col_id>{ col }); }
+
+    /**
+     * Removes a row form the LP.
+     *
+     * @param row ID of the row to be removed
+     */
+    void delete_row(row_id row) { delete_rows(std::vector<row_id>{ row }); }
+
+    /**
+     * Removes many columns form the LP.
+     *
+     * @param cols IDs of the columns to be removed
+     */
+    template <typename Cols> void delete_cols(const Cols &cols) {
+        std::vector<bool> deleted(m_cols.size(), false);
+        std::vector<int> ids;
+        for (col_id col : cols) {
+            for (auto const &elem : get(col).rows) {
+                auto &row = get(elem.first);
+                erase_entry(row.cols, row.index, col);
+            }
+            deleted[m_col_idx.get_idx(col.get())] = true;
+            ids.push_back(col.get());
+        }
+        m_col_idx.erase_all(ids);
+        erase_marked(m_cols, deleted);
+    }
+
+    /**
+     * Removes many rows form the LP.
+     *
+     * @param rows IDs of the rows to be removed
+     */
+    template <typename Rows> void delete_rows(const Rows &rows) {
+        std::vector<bool> deleted(m_rows.size(), false);
+        std::vector<int> ids;
+        for (row_id row : rows) {
+            for (auto const &elem : get(row).cols) {
+                auto &col = get(elem.first);
+                erase_entry(col.rows, col.index, row);
+            }
+            deleted[m_row_idx.get_idx(row.get())] = true;
+            ids.push_back(row.get());
+        }
+        m_row_idx.erase_all(ids);
+        erase_marked(m_rows, deleted);
+    }
+
+    /**
+     * Solves the LP starting from the basis of the auxiliary variables.
+     *
+     * @param type simplex type (primal / dual)
+     *
+     * @return solution status
+     */
+    problem_type solve_simplex(simplex_type type = PRIMAL) {
+        return run_simplex(type, false);
+    }
+
+    /**
+     * Resolves the LP starting from the basis of the previous run.
+     *
+     * @param type simplex type (primal / dual)
+     *
+     * @return solution status
+     */
+    problem_type resolve_simplex(simplex_type type = PRIMAL) {
+        return run_simplex(type, true);
+    }
+
+    /**
+     * Returns the statistics of all the simplex runs on the LP.
+     */
+    const solve_statistics &get_solve_statistics() const {
+        return m_statistics;
+    }
+
+    /**
+     * Returns the found objective function value.
+     * Should be called only after the LP has been solved and if it
+     * wasn't modified afterwards.
+     */
+    double get_obj_value() const {
+        double ret = 0;
+        for (auto const &col : m_cols) {
+            ret += col.cost_coef * col.value;
+        }
+        return ret;
+    }
+
+    /**
+     * Returns column primal value.
+     * Should be called only after the LP has been solved and if it
+     * wasn't modified afterwards.
+     */
+    double get_col_value(col_id col) const { return get(col).value; }
+
+    /**
+     * Returns the column cost function coefficient.
+     */
+    double get_col_coef(col_id col) const { return get(col).cost_coef; }
+
+    /**
+     * Returns the column lower bound.
+     */
+    double get_col_lower_bound(col_id col) const { return get(col).lb; }
+
+    /**
+     * Returns the column upper bound.
+     */
+    double get_col_upper_bound(col_id col) const { return get(col).ub; }
+
+    /**
+     * Returns row dual value.
+     * Should be called only after the LP has been solved and if it
+     * wasn't modified afterwards.
+     */
+    double get_row_dual_value(row_id row) const { return get(row).dual; }
+
+    /**
+     * Returns the row lower bound.
+     */
+    double get_row_lower_bound(row_id row) const { return get(row).lb; }
+
+    /**
+     * Returns the row upper bound.
+     */
+    double get_row_upper_bound(row_id row) const { return get(row).ub; }
+
+    /**
+     * Returns the expression of an existing row.
+     */
+    linear_expression get_row_expression(row_id row) const {
+        linear_expression exp;
+        for (auto const &elem : get(row).cols) {
+            exp += elem.second * elem.first;
+        }
+        return exp;
+    }
+
+    /**
+     * Returns the identifiers and coefficients of all rows in a given column,
+     * which constraint matrix coefficient is non-zero (as an iterator range).
+     */
+    boost::iterator_range<RowsInColumnIterator>
+    get_rows_in_column(col_id col) const {
+        auto const &rows = get(col).rows;
+        return boost::make_iterator_range(rows.begin(), rows.end());
+    }
+
+  private:
+    dual_simplex_impl(dual_simplex_impl &&) {}
+    dual_simplex_impl(const dual_simplex_impl &) {}
+
+    static constexpr double PRIMAL_TOL = 1e-7;
+    static constexpr double DUAL_TOL = 1e-7;
+    static constexpr double PIVOT_TOL = 1e-9;
+    /// pivots between the recomputations of the basis inverse
+    static constexpr int REFACTOR_FREQUENCY = 100;
+    /// degenerate pivots after which the bounds are perturbed (or Bland's
+    /// rule is used, if they already were)
+    static constexpr int DEGENERATE_LIMIT = 50;
+    /// relative size of the bound perturbation
+    static constexpr double PERTURBATION = 1e-6;
+
+    column &get(col_id col) { return m_cols[m_col_idx.get_idx(col.get())]; }
+    const column &get(col_id col) const {
+        return m_cols[m_col_idx.get_idx(col.get())];
+    }
+    row &get(row_id row) { return m_rows[m_row_idx.get_idx(row.get())]; }
+    const row &get(row_id row) const {
+        return m_rows[m_row_idx.get_idx(row.get())];
+    }
+
+    void add_coefficient(row_id row, col_id col, double coef) {
+        auto &col_data = get(col);
+        auto &row_data = get(row);
+        auto iter = col_data.index.find(row.get());
+        if (iter == col_data.index.end()) {
+            if (coef != 0) {
+                col_data.index.emplace(row.get(), col_data.rows.size());
+                col_data.rows.emplace_back(row, coef);
+                row_data.index.emplace(col.get(), row_data.cols.size());
+                row_data.cols.emplace_back(col, coef);
+            }
+            return;
+        }
+        double value = col_data.rows[iter->second].second + coef;
+        if (value == 0) {
+            erase_entry(col_data.rows, col_data.index, row);
+            erase_entry(row_data.cols, row_data.index, col);
+        } else {
+            col_data.rows[iter->second].second = value;
+            row_data.cols[row_data.index.at(col.get())].second = value;
+        }
+    }
+
+    /// removes the entry replacing it by the last one
+    template <typename Entries, typename Id>
+    static void erase_entry(Entries &entries, EntriesIndex &index, Id id) {
+        auto iter = index.find(id.get());
+        assert(iter != index.end());
+        auto pos = iter->second;
+        index.erase(iter);
+        if (pos + 1 != entries.size()) {
+            entries[pos] = entries.back();
+            index[entries[pos].first.get()] = pos;
+        }
+        entries.pop_back();
+    }
+
+    /// removes the marked elements keeping the order of the others
+    template <typename Elements>
+    static void erase_marked(Elements &elements,
+                             const std::vector<bool> &marked) {
+        std::size_t size = 0;
+        for (auto i : irange(elements.size())) {
+            if (!marked[i]) {
+                if (size != i) {
+                    elements[size] = std::move(elements[i]);
+                }
+                ++size;
+            }
+        }
+        elements.resize(size);
+    }
+
+    /**
+     * Optimizes the LP using the simplex method.
+     *
+     * @return solution status
+     */
+    problem_type run_simplex(simplex_type type, bool resolve) {
+        auto start = std::chrono::steady_clock::now();
+        m_iterations = 0;
+
+        build(resolve);
+        factorize();
+        compute_basic_values();
+        problem_type ret = UNDEFINED;
+        if (type == DUAL) {
+            ret = dual();
+        }
+        if (ret != INFEASIBLE) {
+            // after the dual simplex the primal simplex only removes
+            // the dual infeasibilities caused by the rounding errors
+            ret = primal();
+        }
+        assert(ret != UNDEFINED);
+        store_solution();
+
+        ++m_statistics.solves;
+        m_statistics.warm_starts += resolve;
+        m_statistics.iterations += m_iterations;
+        m_statistics.seconds += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        return ret;
+    }
+
+    /// fills the solver data, variables 0, ..., n - 1 are the columns,
+    /// n, ..., n + m - 1 are the auxiliary variables of the rows
+    void build(bool resolve) {
+        m_n = m_cols.size();
+        m_m = m_rows.size();
+        int vars = m_n + m_m;
+        m_a.assign(m_n, {});
+        m_lb.resize(vars);
+        m_ub.resize(vars);
+        m_cost.assign(vars, 0);
+        m_status.resize(vars);
+        m_x.assign(vars, 0);
+        for (auto j : irange(m_n)) {
+            auto const &col = m_cols[j];
+            for (auto const &elem : col.rows) {
+                m_a[j].emplace_back(m_row_idx.get_idx(elem.first.get()),
+                                    elem.second);
+            }
+            m_lb[j] = col.lb;
+            m_ub[j] = col.ub;
+            m_cost[j] = m_sign * col.cost_coef;
+            m_status[j] = resolve ? col.status : AT_LOWER;
+        }
+        for (auto i : irange(m_m)) {
+            m_lb[m_n + i] = m_rows[i].lb;
+            m_ub[m_n + i] = m_rows[i].ub;
+            m_status[m_n + i] = resolve ? m_rows[i].status : BASIC;
+        }
+        for (auto v : irange(vars)) {
+            if (m_status[v] != BASIC) {
+                set_non_basic(v, m_status[v]);
+            }
+        }
+    }
+
+    /// makes the variable non basic, at the bound given by status if it exists
+    void set_non_basic(int v, var_status status) {
+        bool has_lb = m_lb[v] != lp_traits::MINUS_INF;
+        bool has_ub = m_ub[v] != lp_traits::PLUS_INF;
+        if (has_lb && m_lb[v] == m_ub[v]) {
+            m_status[v] = FIXED;
+        } else if (has_ub && (status == AT_UPPER || !has_lb)) {
+            m_status[v] = AT_UPPER;
+        } else if (has_lb) {
+            m_status[v] = AT_LOWER;
+        } else {
+            m_status[v] = FREE;
+        }
+        switch (m_status[v]) {
+        case AT_UPPER:
+            m_x[v] = m_ub[v];
+            break;
+        case FREE:
+            m_x[v] = 0;
+            break;
+        default:
+            m_x[v] = m_lb[v];
+        }
+    }
+
+    /// calls f(row, coef) for the nonzero coefficients of the variable column
+    template <typename Functor> void for_each_in_col(int v, Functor f) const {
+        if (v < m_n) {
+            for (auto const &elem : m_a[v]) {
+                f(elem.first, elem.second);
+            }
+        } else {
+            f(v - m_n, -1.);
+        }
+    }
+
+    /// x = B^{-1} * x
+    void ftran(std::vector<double> &x) const {
+        // the initial basis of the auxiliary variables is -I
+        for (auto &val : x) {
+            val = -val;
+        }
+        for (auto k : irange(m_eta_pos.size())) {
+            int p = m_eta_pos[k];
+            if (x[p] == 0) {
+                continue;
+            }
+            double xp = x[p] / m_eta_pivot[k];
+            x[p] = xp;
+            for (auto e : irange(m_eta_begin[k], m_eta_begin[k + 1])) {
+                x[m_eta_index[e]] -= m_eta_value[e] * xp;
+            }
+        }
+    }
+
+    /// y^T = y^T * B^{-1}
+    void btran(std::vector<double> &y) const {
+        for (auto k = int(m_eta_pos.size()) - 1; k >= 0; --k) {
+            int p = m_eta_pos[k];
+            double yp = y[p];
+            for (auto e : irange(m_eta_begin[k], m_eta_begin[k + 1])) {
+                yp -= m_eta_value[e] * y[m_eta_index[e]];
+            }
+            y[p] = yp / m_eta_pivot[k];
+        }
+        for (auto &val : y) {
+            val = -val;
+        }
+    }
+
+    /// out = B^{-1} * column of v
+    void binv_times_col(int v, std::vector<double> &out) const {
+        out.assign(m_m, 0);
+        for_each_in_col(v, [&](int k, double coef) { out[k] += coef; });
+        ftran(out);
+    }
+
+    double dot_col(const std::vector<double> &vec, int v) const {
+        double ret = 0;
+        for_each_in_col(v, [&](int k, double coef) { ret += vec[k] * coef; });
+        return ret;
+    }
+
+    /// pi = cb^T * B^{-1}
+    void compute_duals(const std::vector<double> &cb,
+                       std::vector<double> &pi) const {
+        pi = cb;
+        btran(pi);
+    }
+
+    /// out = row p of B^{-1}
+    void binv_row(int p, std::vector<double> &out) const {
+        out.assign(m_m, 0);
+        out[p] = 1;
+        btran(out);
+    }
+
+    /// replaces the basic variable at position p, alpha = B^{-1} * entering,
+    /// the basis inverse is multiplied by the elementary matrix of the pivot
+    void pivot(int p, const std::vector<double> &alpha) {
+        m_eta_pos.push_back(p);
+        m_eta_pivot.push_back(alpha[p]);
+        for (auto i : irange(m_m)) {
+            if (i != p && alpha[i] != 0) {
+                m_eta_index.push_back(i);
+                m_eta_value.push_back(alpha[i]);
+            }
+        }
+        m_eta_begin.push_back(m_eta_index.size());
+        ++m_pivots;
+    }
+
+    /// swaps the entering and the leaving variables of position p
+    void change_basis(int p, int entering, const std::vector<double> &alpha) {
+        pivot(p, alpha);
+        m_basis_pos[m_head[p]] = -1;
+        m_head[p] = entering;
+        m_basis_pos[entering] = p;
+        m_status[entering] = BASIC;
+        if (m_pivots >= REFACTOR_FREQUENCY) {
+            factorize();
+            compute_basic_values();
+        }
+    }
+
+    /**
+     * Computes the inverse of the basis given by the statuses, starting from
+     * the basis of the auxiliary variables and pivoting in the basic columns.
+     * The columns which would make the basis singular become non basic,
+     * the missing basic variables are auxiliary.
+     */
+    void factorize() {
+        m_eta_pos.clear();
+        m_eta_pivot.clear();
+        m_eta_begin.assign(1, 0);
+        m_eta_index.clear();
+        m_eta_value.clear();
+        m_head.resize(m_m);
+        m_basis_pos.assign(m_n + m_m, -1);
+        std::vector<bool> replaceable(m_m);
+        for (auto i : irange(m_m)) {
+            m_head[i] = m_n + i;
+            m_basis_pos[m_n + i] = i;
+            replaceable[i] = m_status[m_n + i] != BASIC;
+        }
+        std::vector<double> alpha;
+        for (auto j : irange(m_n)) {
+            if (m_status[j] != BASIC) {
+                continue;
+            }
+            binv_times_col(j, alpha);
+            int p = -1;
+            for (auto i : irange(m_m)) {
+                if (replaceable[i] && std::abs(alpha[i]) > PIVOT_TOL &&
+                    (p == -1 || std::abs(alpha[i]) > std::abs(alpha[p]))) {
+                    p = i;
+                }
+            }
+            if (p == -1) {
+                set_non_basic(j, AT_LOWER);
+                continue;
+            }
+            // the replaced auxiliary variable is non basic
+            replaceable[p] = false;
+            pivot(p, alpha);
+            m_basis_pos[m_head[p]] = -1;
+            m_head[p] = j;
+            m_basis_pos[j] = p;
+        }
+        for (auto i : irange(m_m)) {
+            m_status[m_head[i]] = BASIC;
+        }
+        m_pivots = 0;
+    }
+
+    /// x_B = -B^{-1} * N * x_N, refined once with the residual
+    void compute_basic_values() {
+        std::vector<double> rhs(m_m, 0);
+        for (auto v : irange(m_n + m_m)) {
+            if (m_basis_pos[v] == -1 && m_x[v] != 0) {
+                for_each_in_col(v, [&](int k, double coef) {
+                    rhs[k] -= coef * m_x[v];
+                });
+            }
+        }
+        for (auto i : irange(m_m)) {
+            m_x[m_head[i]] = 0;
+        }
+        auto residual = rhs;
+        for (auto refinement : irange(2)) {
+            ftran(residual);
+            for (auto i : irange(m_m)) {
+                m_x[m_head[i]] += residual[i];
+            }
+            if (refinement == 0) {
+                // residual = rhs - B * x_B, in extended precision, as it
+                // usually vanishes in double
+                std::vector<long double> exact_residual(rhs.begin(), rhs.end());
+                for (auto i : irange(m_m)) {
+                    int v = m_head[i];
+                    for_each_in_col(v, [&](int k, double coef) {
+                        exact_residual[k] -= (long double)coef * m_x[v];
+                    });
+                }
+                residual.assign(exact_residual.begin(), exact_residual.end());
+            }
+        }
+    }
+
+    bool can_increase(int v) const {
+        return m_status[v] == AT_LOWER || m_status[v] == FREE;
+    }
+
+    bool can_decrease(int v) const {
+        return m_status[v] == AT_UPPER || m_status[v] == FREE;
+    }
+
+    double primal_tol(double bound) const {
+        return PRIMAL_TOL * (1 + std::abs(bound));
+    }
+
+    bool below_lb(int v) const {
+        return m_x[v] < m_lb[v] - primal_tol(m_lb[v]);
+    }
+
+    bool above_ub(int v) const {
+        return m_x[v] > m_ub[v] + primal_tol(m_ub[v]);
+    }
+
+    /// leaves the basic variable from position p at the bound
+    void leave_at(int p, bool at_upper) {
+        int v = m_head[p];
+        m_x[v] = at_upper ? m_ub[v] : m_lb[v];
+        m_status[v] = at_upper ? AT_UPPER : AT_LOWER;
+        if (m_lb[v] == m_ub[v]) {
+            m_status[v] = FIXED;
+        }
+    }
+
+    /// counts the iteration, returns false if the method should stop
+    bool next_iteration(int &iterations) {
+        ++m_iterations;
+        return ++iterations <= 100 * (m_n + m_m) + 10000;
+    }
+
+    /// recomputes the basic values if the basis changed since the last
+    /// factorization, returns false if nothing changed
+    bool refresh() {
+        if (m_pivots == 0) {
+            return false;
+        }
+        factorize();
+        compute_basic_values();
+        return true;
+    }
+
+    /**
+     * Expands the bounds by small random values, so that the primal simplex
+     * can leave a degenerate vertex. The original bounds are stored
+     * in lb and ub.
+     */
+    void perturb_bounds(std::vector<double> &lb, std::vector<double> &ub) {
+        lb = m_lb;
+        ub = m_ub;
+        std::mt19937 generator;
+        std::uniform_real_distribution<double> distribution(1, 2);
+        for (auto v : irange(m_n + m_m)) {
+            bool basic = m_basis_pos[v] != -1;
+            if (!basic && m_status[v] == FIXED) {
+                continue;
+            }
+            if (m_lb[v] != lp_traits::MINUS_INF) {
+                m_lb[v] -= PERTURBATION * (1 + std::abs(m_lb[v])) *
+                           distribution(generator);
+                if (!basic && m_status[v] == AT_LOWER) {
+                    m_x[v] = m_lb[v];
+                }
+            }
+            if (m_ub[v] != lp_traits::PLUS_INF) {
+                m_ub[v] += PERTURBATION * (1 + std::abs(m_ub[v])) *
+                           distribution(generator);
+                if (!basic && m_status[v] == AT_UPPER) {
+                    m_x[v] = m_ub[v];
+                }
+            }
+        }
+        compute_basic_values();
+    }
+
+    /// restores the bounds saved by perturb_bounds
+    void restore_bounds(std::vector<double> &lb, std::vector<double> &ub) {
+        m_lb.swap(lb);
+        m_ub.swap(ub);
+        for (auto v : irange(m_n + m_m)) {
+            if (m_basis_pos[v] == -1) {
+                set_non_basic(v, m_status[v]);
+            }
+        }
+        compute_basic_values();
+    }
+
+    /**
+     * The primal simplex method, minimizing the sum of infeasibilities
+     * while the basic variables are not feasible.
+     * Uses Harris ratio test. When it stalls, the bounds are perturbed
+     * until the perturbed problem is solved, then the original bounds are
+     * restored and the method continues from the obtained basis.
+     */
+    problem_type primal() {
+        std::vector<double> cb(m_m), pi, alpha, limits(m_m), lb, ub;
+        std::vector<bool> to_upper(m_m);
+        int degenerate = 0;
+        int iterations = 0;
+        bool can_perturb = true;
+        bool perturbed = false;
+        while (next_iteration(iterations)) {
+            if (degenerate > DEGENERATE_LIMIT && can_perturb) {
+                perturb_bounds(lb, ub);
+                can_perturb = false;
+                perturbed = true;
+                degenerate = 0;
+            }
+            bool phase1 = false;
+            for (auto i : irange(m_m)) {
+                int v = m_head[i];
+                cb[i] = below_lb(v) ? -1. : above_ub(v) ? 1. : 0.;
+                phase1 = phase1 || cb[i] != 0;
+            }
+            if (!phase1) {
+                for (auto i : irange(m_m)) {
+                    cb[i] = m_cost[m_head[i]];
+                }
+            }
+            compute_duals(cb, pi);
+
+            bool bland = degenerate > DEGENERATE_LIMIT;
+            int q = -1;
+            int dir = 0;
+            double best = 0;
+            for (auto v : irange(m_n + m_m)) {
+                if (m_basis_pos[v] != -1) {
+                    continue;
+                }
+                double d = (phase1 ? 0 : m_cost[v]) - dot_col(pi, v);
+                int v_dir = 0;
+                if (d < -DUAL_TOL && can_increase(v)) {
+                    v_dir = 1;
+                } else if (d > DUAL_TOL && can_decrease(v)) {
+                    v_dir = -1;
+                }
+                if (v_dir != 0 && std::abs(d) > best) {
+                    q = v;
+                    dir = v_dir;
+                    best = std::abs(d);
+                    if (bland) {
+                        break;
+                    }
+                }
+            }
+            if (q == -1) {
+                if (refresh()) {
+                    continue;
+                }
+                if (perturbed) {
+                    restore_bounds(lb, ub);
+                    perturbed = false;
+                    continue;
+                }
+                return phase1 ? INFEASIBLE : OPTIMAL;
+            }
+
+            // the first pass finds the maximal step with the bounds relaxed
+            // by the tolerance, the second one chooses the largest pivot
+            // among the variables blocking before it
+            binv_times_col(q, alpha);
+            double max_step = m_ub[q] - m_lb[q];
+            for (auto i : irange(m_m)) {
+                limits[i] = lp_traits::PLUS_INF;
+                if (std::abs(alpha[i]) < PIVOT_TOL) {
+                    continue;
+                }
+                int v = m_head[i];
+                double rate = -alpha[i] * dir;
+                // the infeasible variables are blocked by the violated bound
+                double bound = lp_traits::PLUS_INF;
+                if (rate > 0) {
+                    to_upper[i] = !below_lb(v);
+                    if (!above_ub(v)) {
+                        bound = to_upper[i] ? m_ub[v] : m_lb[v];
+                    }
+                } else {
+                    to_upper[i] = above_ub(v);
+                    if (!below_lb(v)) {
+                        bound = to_upper[i] ? m_ub[v] : m_lb[v];
+                    }
+                }
+                if (std::abs(bound) == lp_traits::PLUS_INF) {
+                    continue;
+                }
+                limits[i] = std::max(0., (bound - m_x[v]) / rate);
+                max_step = std::min(
+                    max_step, (bound - m_x[v] + (rate > 0 ? 1 : -1) *
+                                                    primal_tol(bound)) / rate);
+            }
+            if (max_step == lp_traits::PLUS_INF) {
+                assert(!phase1);
+                if (perturbed) {
+                    restore_bounds(lb, ub);
+                }
+                return UNBOUNDED;
+            }
+            if (bland) {
+                // Bland's rule prevents cycling only with the exact ratio test
+                max_step = m_ub[q] - m_lb[q];
+                for (auto limit : limits) {
+                    max_step = std::min(max_step, limit);
+                }
+            }
+            int leaving = -1;
+            double step = m_ub[q] - m_lb[q];
+            if (step > max_step) {
+                for (auto i : irange(m_m)) {
+                    if (limits[i] <= max_step &&
+                        (leaving == -1 ||
+                         (bland ? m_head[i] < m_head[leaving]
+                                : std::abs(alpha[i]) > std::abs(alpha[leaving])))) {
+                        leaving = i;
+                    }
+                }
+                assert(leaving != -1);
+                step = limits[leaving];
+            }
+            degenerate = step < PRIMAL_TOL ? degenerate + 1 : 0;
+
+            for (auto i : irange(m_m)) {
+                m_x[m_head[i]] -= alpha[i] * dir * step;
+            }
+            m_x[q] += dir * step;
+            if (leaving == -1) {
+                // the entering variable reaches its other bound
+                set_non_basic(q, dir > 0 ? AT_UPPER : AT_LOWER);
+            } else {
+                leave_at(leaving, to_upper[leaving]);
+                change_basis(leaving, q, alpha);
+            }
+        }
+        if (perturbed) {
+            restore_bounds(lb, ub);
+        }
+        return UNDEFINED;
+    }
+
+    /**
+     * The dual simplex method, the leaving variable is chosen by
+     * the infeasibility scaled by the dual steepest edge weight (the squared
+     * norm of the row of the basis inverse), the entering one by Harris
+     * ratio test. The weights start from 1, which is exact for the basis
+     * of the auxiliary variables, and are updated in every pivot.
+     *
+     * @return UNDEFINED if the basis is not dual feasible
+     */
+    problem_type dual() {
+        std::vector<double> cb(m_m), pi, alpha, row_p, tau, row_alpha, ratios;
+        auto compute_pi = [&]() {
+            for (auto i : irange(m_m)) {
+                cb[i] = m_cost[m_head[i]];
+            }
+            compute_duals(cb, pi);
+        };
+
+        // the boxed variables are moved to the bounds making them dual
+        // feasible, for the others dual feasibility is required
+        compute_pi();
+        for (auto v : irange(m_n + m_m)) {
+            if (m_basis_pos[v] != -1 || m_status[v] == FIXED) {
+                continue;
+            }
+            double d = m_cost[v] - dot_col(pi, v);
+            if (d < -DUAL_TOL && can_increase(v)) {
+                if (m_ub[v] == lp_traits::PLUS_INF) {
+                    return UNDEFINED;
+                }
+                set_non_basic(v, AT_UPPER);
+            } else if (d > DUAL_TOL && can_decrease(v)) {
+                if (m_lb[v] == lp_traits::MINUS_INF) {
+                    return UNDEFINED;
+                }
+                set_non_basic(v, AT_LOWER);
+            }
+        }
+        compute_basic_values();
+
+        int degenerate = 0;
+        int iterations = 0;
+        int vars = m_n + m_m;
+        row_alpha.resize(vars);
+        ratios.resize(vars);
+        m_weight.assign(vars, 1);
+        while (next_iteration(iterations)) {
+            bool bland = degenerate > DEGENERATE_LIMIT;
+            int p = -1;
+            double best = 0;
+            for (auto i : irange(m_m)) {
+                int v = m_head[i];
+                double infeasibility = below_lb(v) ? m_lb[v] - m_x[v]
+                                     : above_ub(v) ? m_x[v] - m_ub[v] : 0;
+                if (infeasibility == 0) {
+                    continue;
+                }
+                if (bland) {
+                    if (p == -1 || v < m_head[p]) {
+                        p = i;
+                    }
+                    continue;
+                }
+                double score = infeasibility * infeasibility / m_weight[v];
+                if (score > best) {
+                    p = i;
+                    best = score;
+                }
+            }
+            if (p == -1) {
+                if (refresh()) {
+                    continue;
+                }
+                return OPTIMAL;
+            }
+            int leaving = m_head[p];
+            bool increase = below_lb(leaving);
+
+            compute_pi();
+            binv_row(p, row_p);
+            double max_ratio = lp_traits::PLUS_INF;
+            for (auto v : irange(vars)) {
+                ratios[v] = lp_traits::PLUS_INF;
+                if (m_basis_pos[v] != -1 || m_status[v] == FIXED) {
+                    continue;
+                }
+                double a = dot_col(row_p, v);
+                row_alpha[v] = a;
+                if (std::abs(a) < PIVOT_TOL) {
+                    continue;
+                }
+                // x_leaving changes by -a * dx_v
+                bool up = increase == (a < 0);
+                if (up ? !can_increase(v) : !can_decrease(v)) {
+                    continue;
+                }
+                double d = m_cost[v] - dot_col(pi, v);
+                d = std::max(0., up ? d : -d);
+                ratios[v] = d / std::abs(a);
+                max_ratio = std::min(max_ratio, (d + DUAL_TOL) / std::abs(a));
+            }
+            int q = -1;
+            for (auto v : irange(vars)) {
+                if (ratios[v] <= max_ratio &&
+                    (q == -1 || (bland ? ratios[v] < ratios[q]
+                                       : std::abs(row_alpha[v]) >
+                                             std::abs(row_alpha[q])))) {
+                    q = v;
+                }
+            }
+            if (q == -1) {
+                if (refresh()) {
+                    continue;
+                }
+                return INFEASIBLE;
+            }
+            degenerate = ratios[q] < DUAL_TOL ? degenerate + 1 : 0;
+
+            binv_times_col(q, alpha);
+            double target = increase ? m_lb[leaving] : m_ub[leaving];
+            double dx = (m_x[leaving] - target) / alpha[p];
+            for (auto i : irange(m_m)) {
+                m_x[m_head[i]] -= alpha[i] * dx;
+            }
+            m_x[q] += dx;
+            tau = row_p;
+            ftran(tau);
+            update_weights(p, q, alpha, tau);
+            leave_at(p, !increase);
+            change_basis(p, q, alpha);
+        }
+        return UNDEFINED;
+    }
+
+    /**
+     * Updates the dual steepest edge weights for the pivot replacing
+     * the basic variable at position p by q, tau = B^{-1} * (row p of B^{-1}).
+     */
+    void update_weights(int p, int q, const std::vector<double> &alpha,
+                        const std::vector<double> &tau) {
+        double weight_p = m_weight[m_head[p]];
+        for (auto i : irange(m_m)) {
+            if (i == p || alpha[i] == 0) {
+                continue;
+            }
+            double ratio = alpha[i] / alpha[p];
+            double &weight = m_weight[m_head[i]];
+            weight = std::max(
+                weight + ratio * (ratio * weight_p - 2 * tau[i]), PIVOT_TOL);
+        }
+        m_weight[q] = std::max(weight_p / (alpha[p] * alpha[p]), PIVOT_TOL);
+    }
+
+    /// stores the values, duals and the basis in the columns and rows
+    void store_solution() {
+        std::vector<double> cb(m_m), pi;
+        for (auto i : irange(m_m)) {
+            cb[i] = m_cost[m_head[i]];
+        }
+        compute_duals(cb, pi);
+        for (auto j : irange(m_n)) {
+            m_cols[j].value = m_x[j];
+            m_cols[j].status = m_status[j];
+        }
+        for (auto i : irange(m_m)) {
+            m_rows[i].dual = m_sign * pi[i];
+            m_rows[i].status = m_status[m_n + i];
+        }
+    }
+
+    std::vector<column> m_cols;
+    std::vector<row> m_rows;
+
+    /// mapping between positions of the columns and column IDs
+    data_structures::eraseable_bimap<int> m_col_idx;
+    /// mapping between positions of the rows and row IDs
+    data_structures::eraseable_bimap<int> m_row_idx;
+
+    int m_total_col_nr;
+    int m_total_row_nr;
+    /// 1 for minimization, -1 for maximization
+    int m_sign;
+
+    solve_statistics m_statistics;
+
+    // data of the current run
+    int m_n;
+    int m_m;
+    /// columns with row positions
+    std::vector<std::vector<std::pair<int, double>>> m_a;
+    std::vector<double> m_lb;
+    std::vector<double> m_ub;
+    std::vector<double> m_cost;
+    std::vector<double> m_x;
+    std::vector<var_status> m_status;
+    /// basic variable at the given position of the basis
+    std::vector<int> m_head;
+    /// position in the basis or -1 for non basic variables
+    std::vector<int> m_basis_pos;
+    /// the basis inverse is E_k^{-1} * ... * E_1^{-1} * (-I), where
+    /// the elementary matrix E_k differs from I in the column m_eta_pos[k],
+    /// which is B^{-1} * entering of the pivot k: m_eta_pivot[k] at the
+    /// diagonal and m_eta_value[e] in the rows m_eta_index[e],
+    /// for e in [m_eta_begin[k], m_eta_begin[k + 1])
+    std::vector<int> m_eta_pos;
+    std::vector<double> m_eta_pivot;
+    std::vector<int> m_eta_begin;
+    std::vector<int> m_eta_index;
+    std::vector<double> m_eta_value;
+    /// dual steepest edge weights of the basic variables
+    std::vector<double> m_weight;
+    int m_pivots;
+    int m_iterations;
+};
+
+} // detail
+
+/// LP solved by the built-in dual simplex method, which can be used by many
+/// threads (each thread using its own instances)
+using dual_simplex = detail::lp_base<detail::dual_simplex_impl>;
+
+} // lp
+} // paal
+
+#endif // PAAL_DUAL_SIMPLEX_HPP
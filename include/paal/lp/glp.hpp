@@ -20,6 +20,7 @@
 #include "paal/lp/ids.hpp"
 #include "paal/lp/lp_base.hpp"
 #include "paal/lp/problem_type.hpp"
+#include "paal/lp/solve_statistics.hpp"
 #include "paal/utils/irange.hpp"
 
 #include <boost/range/iterator_range.hpp>
@@ -27,6 +28,10 @@
 
 #include <glpk.h>
 
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
 namespace paal {
 namespace lp {
 
@@ -84,6 +89,7 @@ class glp_impl {
      * @return column identifier
      */
     col_id add_column(double cost_coef, double lb, double ub) {
+        assert(!has_staged());
         int colNr = glp_add_cols(m_lp, 1);
 
         glp_set_col_bnds(m_lp, colNr, bounds_to_glp_type(lb, ub), lb, ub);
@@ -104,6 +110,7 @@ class glp_impl {
      * @return row identifier
      */
     row_id add_row(const double_bounded_expression &constraint) {
+        assert(!has_staged());
         int rowNr = glp_add_rows(m_lp, 1);
         auto lb = constraint.get_lower_bound();
         auto ub = constraint.get_upper_bound();
@@ -119,6 +126,143 @@ class glp_impl {
         return row;
     }
 
+    /**
+     * Stages a new column, the staged columns are added to the LP
+     * by load_staged.
+     * Until then the column identifier can be used only in the staging calls.
+     *
+     * @param cost_coef coefficient of the column in the objective function
+     * @param lb column lower bound value
+     * @param ub column upper bound value
+     *
+     * @return column identifier
+     */
+    col_id stage_column(double cost_coef, double lb, double ub) {
+        m_staged_cols.push_back(staged_bounds{ cost_coef, lb, ub });
+        resize_col_tmp();
+        ++m_total_col_nr;
+        m_col_idx.add(m_total_col_nr - 1);
+        return col_id(m_total_col_nr - 1);
+    }
+
+    /**
+     * Stages a new row, the staged rows are added to the LP by load_staged.
+     * Until then the row identifier can be used only in the staging calls.
+     *
+     * @param constraint constraint being added
+     *
+     * @return row identifier
+     */
+    row_id stage_row(const double_bounded_expression &constraint) {
+        m_staged_rows.push_back(staged_bounds{ 0, constraint.get_lower_bound(),
+                                               constraint.get_upper_bound() });
+        resize_row_tmp();
+        ++m_total_row_nr;
+        m_row_idx.add(m_total_row_nr - 1);
+        auto row = row_id(m_total_row_nr - 1);
+
+        auto expr = constraint.get_expression();
+        for (auto elem : expr.get_elements()) {
+            stage_coefficient(row, elem.first, elem.second);
+        }
+        return row;
+    }
+
+    /**
+     * Stages a coefficient of the constraint matrix in a staged row,
+     * coefficients staged many times for the same row and column are summed.
+     *
+     * @param row staged row identifier
+     * @param col column identifier
+     * @param coef coefficient value
+     */
+    void stage_coefficient(row_id row, col_id col, double coef) {
+        assert(get_row(row) > glp_get_num_rows(m_lp));
+        m_staged_coefs.push_back(staged_coef{ get_row(row), get_col(col), coef });
+    }
+
+    /**
+     * Adds the staged columns and rows to the LP. If the constraint matrix
+     * has no coefficients yet, it is loaded by one glp_load_matrix call.
+     */
+    void load_staged() {
+        if (!m_staged_cols.empty()) {
+            int first = glp_add_cols(m_lp, m_staged_cols.size());
+            for (auto col : m_staged_cols | boost::adaptors::indexed(first)) {
+                auto const &b = col.value();
+                glp_set_col_bnds(m_lp, col.index(),
+                                 bounds_to_glp_type(b.lb, b.ub), b.lb, b.ub);
+                glp_set_obj_coef(m_lp, col.index(), b.cost_coef);
+            }
+        }
+        if (!m_staged_rows.empty()) {
+            int first = glp_add_rows(m_lp, m_staged_rows.size());
+            for (auto row : m_staged_rows | boost::adaptors::indexed(first)) {
+                auto const &b = row.value();
+                glp_set_row_bnds(m_lp, row.index(),
+                                 bounds_to_glp_type(b.lb, b.ub), b.lb, b.ub);
+            }
+        }
+
+        auto &coefs = m_staged_coefs;
+        std::sort(coefs.begin(), coefs.end(),
+                  [](const staged_coef &a, const staged_coef &b) {
+            return std::make_pair(a.row, a.col) < std::make_pair(b.row, b.col);
+        });
+        // merge the duplicates and remove zeros, GLPK does not accept them
+        std::size_t size = 0;
+        for (auto const &c : coefs) {
+            if (size > 0 && coefs[size - 1].row == c.row &&
+                coefs[size - 1].col == c.col) {
+                coefs[size - 1].coef += c.coef;
+            } else {
+                coefs[size++] = c;
+            }
+        }
+        coefs.resize(size);
+        coefs.erase(std::remove_if(coefs.begin(), coefs.end(),
+                                   [](const staged_coef &c) {
+                        return c.coef == 0;
+                    }),
+                    coefs.end());
+        size = coefs.size();
+
+        if (glp_get_num_nz(m_lp) == 0) {
+            // GLPK arrays are indexed from 1
+            Ids rows(size + 1), cols(size + 1);
+            Vals vals(size + 1);
+            for (auto c : coefs | boost::adaptors::indexed(1)) {
+                rows[c.index()] = c.value().row;
+                cols[c.index()] = c.value().col;
+                vals[c.index()] = c.value().coef;
+            }
+            glp_load_matrix(m_lp, size, &rows[0], &cols[0], &vals[0]);
+        } else {
+            // the matrix would be replaced by glp_load_matrix,
+            // so the staged rows are set one by one
+            auto begin = coefs.begin();
+            while (begin != coefs.end()) {
+                auto end = std::find_if(begin, coefs.end(),
+                                        [&](const staged_coef &c) {
+                    return c.row != begin->row;
+                });
+                int row_size = 0;
+                for (auto const &c : boost::make_iterator_range(begin, end)) {
+                    ++row_size;
+                    m_idx_cols_tmp[row_size] = c.col;
+                    m_val_cols_tmp[row_size] = c.coef;
+                }
+                glp_set_mat_row(m_lp, begin->row, row_size, &m_idx_cols_tmp[0],
+                                &m_val_cols_tmp[0]);
+                begin = end;
+            }
+        }
+
+        m_staged_cols.clear();
+        m_staged_rows.clear();
+        m_staged_coefs.clear();
+    }
+
     /**
      * Sets the lower bound of an existing LP column.
      *
@@ -202,8 +346,10 @@ class glp_impl {
      * @param col ID of the column to be removed
      */
     void delete_col(col_id col) {
+        assert(!has_staged());
         int arr[2];
         arr[1] = get_col(col);
+        keep_basis_on_cols_deletion(arr + 1, arr + 2);
         m_col_idx.erase(col.get());
         glp_del_cols(m_lp, 1, arr);
     }
@@ -214,12 +360,58 @@ class glp_impl {
      * @param row ID of the row to be removed
      */
     void delete_row(row_id row) {
+        assert(!has_staged());
         int arr[2];
         arr[1] = get_row(row);
+        keep_basis_on_rows_deletion(arr + 1, arr + 2);
         m_row_idx.erase(row.get());
         glp_del_rows(m_lp, 1, arr);
     }
 
+    /**
+     * Removes columns form the LP in one call.
+     *
+     * @param cols IDs of the columns to be removed
+     */
+    template <typename Cols> void delete_cols(const Cols &cols) {
+        assert(!has_staged());
+        // GLPK arrays are indexed from 1
+        Ids arr(1);
+        Ids ids;
+        for (col_id col : cols) {
+            arr.push_back(get_col(col));
+            ids.push_back(col.get());
+        }
+        if (ids.empty()) {
+            return;
+        }
+        keep_basis_on_cols_deletion(arr.begin() + 1, arr.end());
+        m_col_idx.erase_all(ids);
+        glp_del_cols(m_lp, ids.size(), &arr[0]);
+    }
+
+    /**
+     * Removes rows form the LP in one call.
+     *
+     * @param rows IDs of the rows to be removed
+     */
+    template <typename Rows> void delete_rows(const Rows &rows) {
+        assert(!has_staged());
+        // GLPK arrays are indexed from 1
+        Ids arr(1);
+        Ids ids;
+        for (row_id row : rows) {
+            arr.push_back(get_row(row));
+            ids.push_back(row.get());
+        }
+        if (ids.empty()) {
+            return;
+        }
+        keep_basis_on_rows_deletion(arr.begin() + 1, arr.end());
+        m_row_idx.erase_all(ids);
+        glp_del_rows(m_lp, ids.size(), &arr[0]);
+    }
+
     /**
      * Solves the LP using the primal simplex method.
      *
@@ -243,6 +435,13 @@ class glp_impl {
         return run_simplex(type, true);
     }
 
+    /**
+     * Returns the statistics of all the simplex runs on the LP.
+     */
+    const solve_statistics &get_solve_statistics() const {
+        return m_statistics;
+    }
+
     /**
      * Returns the found objective function value.
      * Should be called only after the LP has been solved and if it
@@ -445,9 +644,14 @@ class glp_impl {
      * @return solution status
      */
     problem_type run_simplex(simplex_type type, bool resolve) {
+        assert(!has_staged());
+        auto start = std::chrono::steady_clock::now();
+        int iterations = glp_get_it_cnt(m_lp);
+
         m_glpk_control.meth = simplex_type_to_glp(type);
         static const std::string buggy_version = "4.52";
-        if (!resolve || glp_version() == buggy_version) {
+        bool warm_start = resolve && glp_version() != buggy_version;
+        if (!warm_start) {
             //TODO waiting for response to on
             //http://lists.gnu.org/archive/html/bug-glpk/2014-06/msg00000.html
             glp_adv_basis(m_lp, 0);
@@ -455,13 +659,74 @@ class glp_impl {
         int ret = glp_simplex(m_lp, &m_glpk_control);
         if (resolve && ret != 0) {
             // if basis is not valid, create basis and try again
+            warm_start = false;
             glp_adv_basis(m_lp, 0);
             ret = glp_simplex(m_lp, &m_glpk_control);
         }
         assert(ret == 0);
+
+        ++m_statistics.solves;
+        m_statistics.warm_starts += warm_start;
+        m_statistics.iterations += glp_get_it_cnt(m_lp) - iterations;
+        m_statistics.seconds += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
         return get_primal_type();
     }
 
+    /**
+     * Before deleting basic columns, makes the auxiliary variables of some of
+     * their rows basic, so that the basis remains valid for resolving.
+     * If it turns out singular, the basis is recreated by run_simplex.
+     *
+     * @param begin GLPK numbers of the deleted columns
+     * @param end
+     */
+    template <typename Iter> void keep_basis_on_cols_deletion(Iter begin, Iter end) {
+        for (int col : boost::make_iterator_range(begin, end)) {
+            if (glp_get_col_stat(m_lp, col) != GLP_BS) {
+                continue;
+            }
+            int size = glp_get_mat_col(m_lp, col, &m_idx_rows_tmp[0],
+                                       &m_val_rows_tmp[0]);
+            for (int row : boost::make_iterator_range(
+                     m_idx_rows_tmp.begin() + 1,
+                     m_idx_rows_tmp.begin() + size + 1)) {
+                if (glp_get_row_stat(m_lp, row) != GLP_BS) {
+                    glp_set_row_stat(m_lp, row, GLP_BS);
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * Before deleting rows with non basic auxiliary variables, makes some of
+     * the basic columns in these rows non basic, so that the basis remains
+     * valid for resolving.
+     * If it turns out singular, the basis is recreated by run_simplex.
+     *
+     * @param begin GLPK numbers of the deleted rows
+     * @param end
+     */
+    template <typename Iter> void keep_basis_on_rows_deletion(Iter begin, Iter end) {
+        for (int row : boost::make_iterator_range(begin, end)) {
+            if (glp_get_row_stat(m_lp, row) == GLP_BS) {
+                continue;
+            }
+            int size = glp_get_mat_row(m_lp, row, &m_idx_cols_tmp[0],
+                                       &m_val_cols_tmp[0]);
+            for (int col : boost::make_iterator_range(
+                     m_idx_cols_tmp.begin() + 1,
+                     m_idx_cols_tmp.begin() + size + 1)) {
+                if (glp_get_col_stat(m_lp, col) == GLP_BS) {
+                    // GLPK replaces GLP_NL according to the column bounds
+                    glp_set_col_stat(m_lp, col, GLP_NL);
+                    break;
+                }
+            }
+        }
+    }
+
     /**
      * Converts the GLPK soltion status into paal::lp::problem_type.
      *
@@ -490,6 +755,11 @@ class glp_impl {
         }
     }
 
+    /// staged columns or rows are waiting for load_staged
+    bool has_staged() const {
+        return !m_staged_cols.empty() || !m_staged_rows.empty();
+    }
+
     void resize_col_tmp() {
         m_idx_cols_tmp.push_back(0);
         m_val_cols_tmp.push_back(0);
@@ -513,11 +783,31 @@ class glp_impl {
     int m_total_col_nr;
     int m_total_row_nr;
 
+    solve_statistics m_statistics;
+
     mutable Ids m_idx_cols_tmp;
     mutable Ids m_idx_rows_tmp;
     mutable Vals m_val_cols_tmp;
     mutable Vals m_val_rows_tmp;
     mutable IdsVals m_rows_tmp;
+
+    /// bounds and cost of the staged column or row
+    struct staged_bounds {
+        double cost_coef;
+        double lb;
+        double ub;
+    };
+
+    /// coefficient of the constraint matrix with GLPK row and column numbers
+    struct staged_coef {
+        int row;
+        int col;
+        double coef;
+    };
+
+    std::vector<staged_bounds> m_staged_cols;
+    std::vector<staged_bounds> m_staged_rows;
+    std::vector<staged_coef> m_staged_coefs;
 };
 } // detail
 
@@ -115,6 +115,58 @@ template <typename LP> class lp_base : public LP {
         return rowId;
     }
 
+    /**
+     * Stages a new column. Staged columns and rows are added to the LP
+     * by load_staged(), which is much faster than adding them one by one.
+     * Until then the identifier can be used only in the staging calls.
+     *
+     * @param cost_coef coefficient of the column in the objective function
+     * @param lb column lower bound value
+     * @param ub column upper bound value
+     * @param name column symbolic name
+     *
+     * @return column identifier
+     */
+    col_id stage_column(double cost_coef = 0, double lb = 0.,
+                        double ub = lp_traits::PLUS_INF,
+                        const std::string &name = "") {
+        col_id colId = LP::stage_column(cost_coef, lb, ub);
+        m_col_ids.insert(colId);
+        m_col_names.insert(std::make_pair(colId, name));
+        return colId;
+    }
+
+    /**
+     * Stages a new row, see stage_column().
+     *
+     * @param constraint constraint being added
+     * @param name row symbolic name
+     *
+     * @return row identifier
+     */
+    row_id stage_row(const double_bounded_expression &constraint =
+                         double_bounded_expression{},
+                     const std::string &name = "") {
+        row_id rowId = LP::stage_row(constraint);
+        m_row_ids.insert(rowId);
+        m_row_names.insert(std::make_pair(rowId, name));
+        return rowId;
+    }
+
+    /**
+     * Stages a coefficient of a staged row.
+     * Coefficients staged many times for the same row and column are summed.
+     */
+    void stage_coefficient(row_id row, col_id col, double coef) {
+        LP::stage_coefficient(row, col, coef);
+    }
+
+    /**
+     * Adds the staged columns and rows to the LP.
+     * Has to be called before any other modification or solving of the LP.
+     */
+    void load_staged() { LP::load_staged(); }
+
     /**
      * Returns the number of columns in the instance.
      */
@@ -193,19 +245,43 @@ template <typename LP> class lp_base : public LP {
         assert(nr == 1);
     }
 
+    /**
+     * Removes many columns from the LP at once.
+     *
+     * @param cols IDs of the columns to be removed
+     */
+    template <typename Cols> void delete_cols(const Cols &cols) {
+        LP::delete_cols(cols);
+        for (col_id col : cols) {
+            m_col_names.erase(col);
+            std::size_t nr = m_col_ids.erase(col);
+            assert(nr == 1);
+        }
+    }
+
+    /**
+     * Removes many rows from the LP at once.
+     *
+     * @param rows IDs of the rows to be removed
+     */
+    template <typename Rows> void delete_rows(const Rows &rows) {
+        LP::delete_rows(rows);
+        for (row_id row : rows) {
+            m_row_names.erase(row);
+            std::size_t nr = m_row_ids.erase(row);
+            assert(nr == 1);
+        }
+    }
+
     /**
      * Clears the LP instance.
      */
     void clear() {
-        for (auto &&row : m_row_ids) {
-            LP::delete_row(row);
-        }
+        LP::delete_rows(m_row_ids);
         m_row_names.clear();
         m_row_ids.clear();
 
-        for (auto &&col : m_col_ids) {
-            LP::delete_col(col);
-        }
+        LP::delete_cols(m_col_ids);
         m_col_names.clear();
         m_col_ids.clear();
     }
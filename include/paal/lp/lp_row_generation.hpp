@@ -18,9 +18,16 @@
 #include "paal/lp/lp_base.hpp"
 #include "paal/lp/problem_type.hpp"
 #include "paal/utils/rotate.hpp"
+#include "paal/data_structures/thread_pool.hpp"
 
 #include <boost/range/counting_range.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+
 namespace paal {
 namespace lp {
 
@@ -209,6 +216,280 @@ struct random_violated_separation_oracle {
    }
 };
 
+namespace detail {
+
+/// copy of HowViolated used by one thread: clone() if HowViolated has it
+template <class HowViolated>
+auto clone_for_thread(const HowViolated &how_violated, int)
+    -> decltype(how_violated.clone()) {
+   return how_violated.clone();
+}
+
+template <class HowViolated>
+HowViolated clone_for_thread(const HowViolated &how_violated, long) {
+   return how_violated;
+}
+
+/**
+ * Evaluates how_violated(*candidates[i]) on threads_count threads,
+ * candidates are taken in the increasing order, evaluate(how, i)
+ * is called for every result and evaluation stops
+ * when continue_from(i) returns false.
+ * The first thread uses how_violated, other threads use its clones.
+ */
+template <class Candidates, class HowViolated, class Evaluate, class Continue>
+void parallel_evaluate(const Candidates &candidates, HowViolated &how_violated,
+                       unsigned threads_count, Evaluate evaluate,
+                       Continue continue_from) {
+   using clone_t = puretype(clone_for_thread(how_violated, 0));
+   auto const threads_num = std::max(1u,
+         std::min<unsigned>(threads_count, candidates.size()));
+   // clones are created before the evaluation starts,
+   // because the evaluation might change how_violated
+   std::vector<clone_t> clones;
+   clones.reserve(threads_num - 1);
+   for (unsigned t = 1; t < threads_num; ++t) {
+      clones.push_back(clone_for_thread(how_violated, 0));
+   }
+
+   std::atomic<std::size_t> next{0};
+   auto work = [&](auto &how) {
+      std::size_t i;
+      while ((i = next++) < candidates.size() && continue_from(i)) {
+         evaluate(how(*candidates[i]), i);
+      }
+   };
+   thread_pool threads(threads_num);
+   threads.post([&]() { work(how_violated); });
+   for (auto &clone : clones) {
+      threads.post([&]() { work(clone); });
+   }
+   threads.run();
+}
+
+} //! detail
+
+/**
+ * @brief functor for adding maximum violated constraint,
+ * candidates are checked on many threads.
+ * If HowViolated has clone() member function, every thread but one uses
+ * its clone, otherwise its copy, so HowViolated must not share mutable state
+ * between copies or clones.
+ * Ties are resolved as in add_max_violated, so the result is deterministic.
+ *
+ * @tparam GetCandidates
+ * @tparam HowViolated
+ * @tparam AddViolated
+ * @tparam CompareHow
+ */
+template<
+    class GetCandidates,
+    class HowViolated,
+    class AddViolated,
+    class CompareHow
+>
+class add_max_violated_parallel {
+   GetCandidates m_get_candidates;
+   HowViolated m_how_violated;
+   AddViolated m_add_violated;
+   CompareHow m_cmp;
+   unsigned m_threads_count;
+
+   public:
+      ///contructor
+      add_max_violated_parallel(GetCandidates get_candidates,
+            HowViolated how_violated, AddViolated add_violated, CompareHow cmp,
+            unsigned threads_count)
+         : m_get_candidates(get_candidates), m_how_violated(how_violated),
+            m_add_violated(add_violated), m_cmp(cmp),
+            m_threads_count(threads_count) {}
+
+      ///operator()
+      bool operator()() {
+         auto&& cands = m_get_candidates();
+         using how_violated_t = puretype(m_how_violated(*std::begin(cands)));
+         using cand_it_t = puretype(std::begin(cands));
+         std::vector<cand_it_t> candidates;
+         for (auto cand : boost::counting_range(cands)) {
+            candidates.push_back(cand);
+         }
+         std::vector<boost::optional<how_violated_t>> hows(candidates.size());
+         detail::parallel_evaluate(candidates, m_how_violated, m_threads_count,
+               [&](how_violated_t how, std::size_t i) {
+                  if (how) hows[i] = std::move(how);
+               },
+               [](std::size_t) { return true; });
+
+         boost::optional<std::size_t> most;
+         for (std::size_t i = 0; i < hows.size(); ++i) {
+            if (!hows[i]) continue;
+            if (!most || m_cmp(*hows[*most], *hows[i])) most = i;
+         }
+         if (!most) return false;
+         m_add_violated(*candidates[*most]);
+         return true;
+      }
+};
+
+/**
+ * @brief max_violated_separation_oracle checking candidates on many threads,
+ * see add_max_violated_parallel
+ */
+class parallel_max_violated_separation_oracle {
+   unsigned m_threads_count;
+
+   public:
+   ///constructor
+   parallel_max_violated_separation_oracle(
+         unsigned threads_count = std::thread::hardware_concurrency())
+      : m_threads_count(threads_count) {}
+
+   template <
+      class GetCandidates,
+      class HowViolated,
+      class AddViolated,
+      class CompareHow = utils::less
+   >
+   ///operator()
+   auto operator()(
+      GetCandidates get_candidates,
+      HowViolated is_violated,
+      AddViolated add_violated,
+      CompareHow compare_how = CompareHow{}
+   ) const {
+      return add_max_violated_parallel<GetCandidates, HowViolated, AddViolated,
+         CompareHow>(get_candidates, is_violated, add_violated, compare_how,
+               m_threads_count);
+   }
+};
+
+/**
+ * @brief functor for adding the first violated constraint,
+ * candidates are checked on many threads, see add_max_violated_parallel.
+ * The added constraint is the first violated one in the order
+ * of the reordered candidates, as in add_first_violated.
+ *
+ * @tparam GetCandidates
+ * @tparam HowViolated
+ * @tparam AddViolated
+ * @tparam ReorderCandidates
+ */
+template <class GetCandidates,
+          class HowViolated,
+          class AddViolated,
+          class ReorderCandidates>
+class add_first_violated_parallel {
+   GetCandidates m_get_candidates;
+   HowViolated m_how_violated;
+   AddViolated m_add_violated;
+   ReorderCandidates m_reorder_candidates;
+   unsigned m_threads_count;
+
+   public:
+      ///constructor
+      add_first_violated_parallel(
+         GetCandidates get_candidates,
+         HowViolated how_violated,
+         AddViolated add_violated,
+         ReorderCandidates reorder_candidates,
+         unsigned threads_count
+      ) : m_get_candidates(get_candidates),
+         m_how_violated(how_violated),
+         m_add_violated(add_violated),
+         m_reorder_candidates(std::move(reorder_candidates)),
+         m_threads_count(threads_count) {}
+
+      ///operator()
+      bool operator()() {
+         auto&& cands = m_get_candidates();
+         auto reordered =
+            m_reorder_candidates(std::forward<decltype(cands)>(cands));
+         using cand_it_t = puretype(std::begin(reordered));
+         std::vector<cand_it_t> candidates;
+         for (auto c : boost::counting_range(reordered)) {
+            candidates.push_back(c);
+         }
+         auto const none = std::numeric_limits<std::size_t>::max();
+         // the smallest index of violated candidate found so far
+         std::atomic<std::size_t> first{none};
+         detail::parallel_evaluate(candidates, m_how_violated, m_threads_count,
+               [&](auto &&how, std::size_t i) {
+                  if (!how) return;
+                  auto current = first.load();
+                  while (i < current &&
+                         !first.compare_exchange_weak(current, i));
+               },
+               [&](std::size_t i) { return i < first.load(); });
+
+         if (first == none) return false;
+         m_add_violated(*candidates[first]);
+         return true;
+      }
+};
+
+/**
+ * @brief first_violated_separation_oracle checking candidates on many
+ * threads, see add_first_violated_parallel
+ */
+class parallel_first_violated_separation_oracle {
+   unsigned m_threads_count;
+
+   public:
+   ///constructor
+   parallel_first_violated_separation_oracle(
+         unsigned threads_count = std::thread::hardware_concurrency())
+      : m_threads_count(threads_count) {}
+
+   template <
+      class GetCandidates,
+      class HowViolated,
+      class AddViolated,
+      class ReorderCandidates = utils::identity_functor
+   >
+   ///operator()
+   auto operator() (
+      GetCandidates get_candidates,
+      HowViolated how_violated,
+      AddViolated add_violated,
+      ReorderCandidates reorder_candidates = ReorderCandidates{}
+   ) const {
+      return add_first_violated_parallel<GetCandidates, HowViolated,
+         AddViolated, ReorderCandidates>(get_candidates, how_violated,
+            add_violated, reorder_candidates, m_threads_count);
+   }
+};
+
+/**
+ * @brief random_violated_separation_oracle checking candidates on many
+ * threads, see add_first_violated_parallel
+ */
+class parallel_random_violated_separation_oracle {
+   unsigned m_threads_count;
+
+   public:
+   ///constructor
+   parallel_random_violated_separation_oracle(
+         unsigned threads_count = std::thread::hardware_concurrency())
+      : m_threads_count(threads_count) {}
+
+   template <
+      class GetCandidates,
+      class HowViolated,
+      class AddViolated,
+      class URNG = std::default_random_engine
+   >
+   ///operator()
+   auto operator() (
+      GetCandidates get_candidates,
+      HowViolated how_violated,
+      AddViolated add_violated,
+      URNG&& g = URNG{}
+   ) const {
+      return parallel_first_violated_separation_oracle{m_threads_count}(
+            get_candidates, how_violated, add_violated,
+            detail::make_random_rotate(std::forward<URNG>(g)));
+   }
+};
 
 } // lp
 } // paal
@@ -0,0 +1,58 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file solve_statistics.hpp
+ * @brief statistics of the simplex runs of an LP
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_SOLVE_STATISTICS_HPP
+#define PAAL_SOLVE_STATISTICS_HPP
+
+namespace paal {
+namespace lp {
+
+/**
+ * @brief Statistics of the simplex runs, accumulated by the LP from its
+ * creation. The statistics of a part of the computation are the difference
+ * of the statistics taken after and before it.
+ */
+struct solve_statistics {
+    /// number of simplex runs
+    int solves = 0;
+    /// number of simplex runs started from the previous basis
+    int warm_starts = 0;
+    /// number of simplex iterations
+    int iterations = 0;
+    /// time spent in the simplex
+    double seconds = 0;
+};
+
+/**
+ * @brief statistics of the simplex runs between two measurements
+ *
+ * @param after
+ * @param before
+ *
+ * @return
+ */
+inline solve_statistics operator-(const solve_statistics &after,
+                                  const solve_statistics &before) {
+    solve_statistics ret;
+    ret.solves = after.solves - before.solves;
+    ret.warm_starts = after.warm_starts - before.warm_starts;
+    ret.iterations = after.iterations - before.iterations;
+    ret.seconds = after.seconds - before.seconds;
+    return ret;
+}
+
+} //!lp
+} //!paal
+
+#endif // PAAL_SOLVE_STATISTICS_HPP
@@ -63,6 +63,7 @@ template <typename LP> class multiway_cut_lp {
 
         add_variables(graph, k, weight_map);
         add_constraints(graph, k, index_map, color_map);
+        m_lp.load_staged();
     }
 
   private:
@@ -72,13 +73,13 @@ template <typename LP> class multiway_cut_lp {
     void add_variables(const Graph &graph, int k, const WeightMap &weight_map) {
         for (auto e : boost::as_array(edges(graph))) {
             for (int i = 0; i < k; ++i) {
-                auto col_idx = m_lp.add_column(get(weight_map, e));
+                auto col_idx = m_lp.stage_column(get(weight_map, e));
                 edges_column.push_back(col_idx);
             }
         }
         for (unsigned vertex = 0; vertex <= num_vertices(graph); ++vertex) {
             for (int i = 0; i < k; ++i) {
-                auto col_idx = m_lp.add_column(0);
+                auto col_idx = m_lp.stage_column(0);
                 vertices_column.push_back(col_idx);
             }
         }
@@ -99,7 +100,7 @@ template <typename LP> class multiway_cut_lp {
                         vertices_column[vertices_column_index(sour, k, i)];
                     auto x_trg =
                         vertices_column[vertices_column_index(targ, k, i)];
-                    m_lp.add_row(
+                    m_lp.stage_row(
                         x_e + (j * 2 - 1) * x_src + (1 - 2 * j) * x_trg >= 0);
                 }
             }
@@ -111,13 +112,13 @@ template <typename LP> class multiway_cut_lp {
             if (col != 0) {
                 auto x_col = vertices_column[
                     vertices_column_index(db_index, k, col - 1)];
-                m_lp.add_row(x_col == 1);
+                m_lp.stage_row(x_col == 1);
             }
             lp::linear_expression expr;
             for (auto i : irange(k)) {
                 expr += vertices_column[vertices_column_index(db_index, k, i)];
             }
-            m_lp.add_row(std::move(expr) == 1);
+            m_lp.stage_row(std::move(expr) == 1);
             ++db_index;
         }
     }
@@ -23,6 +23,7 @@
 #include <boost/range/algorithm/generate.hpp>
 #include <boost/range/algorithm/min_element.hpp>
 #include <boost/range/algorithm_ext/iota.hpp>
+#include <boost/range/begin.hpp>
 #include <boost/range/counting_range.hpp>
 #include <boost/range/empty.hpp>
 #include <boost/range/iterator.hpp>
@@ -33,12 +34,16 @@
 #include <boost/numeric/ublas/vector_sparse.hpp>
 #include <boost/numeric/ublas/vector_expression.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <functional>
+#include <iterator>
 #include <random>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace paal {
 
@@ -182,6 +187,15 @@ public:
                m_w == other.m_w;
     }
 
+    ///random vector r
+    r_param_t const & get_r() const { return m_r; }
+
+    ///shift b
+    FloatType get_b() const { return m_b; }
+
+    ///width w
+    FloatType get_w() const { return m_w; }
+
     /**
      * @brief operator()
      *
@@ -251,6 +265,172 @@ public:
     }
 };
 
+namespace detail {
+    /// y[i] += x * r[i] for i in [0, size), written to be auto vectorized
+    template <typename FloatType>
+    void add_scaled(FloatType * y, FloatType const * r, FloatType x, std::size_t size) {
+        for (std::size_t i = 0; i < size; ++i) {
+            y[i] += x * r[i];
+        }
+    }
+} //! detail
+
+/**
+ * @brief Tuple of l_p_hash_functions evaluated at once.
+ *
+ * Random vectors of all functions are packed into one contiguous matrix,
+ * stored dimension by dimension, so the evaluation is a single matrix-vector product
+ * computed as a sequence of vectorizable updates (one per point coordinate).
+ * For sparse points only the rows of nonzero coordinates are touched.
+ * Results are the same as for the tuple of separate l_p_hash_functions.
+ */
+template <typename FloatType = double>
+class l_p_hash_function_tuple {
+    std::size_t m_dimensions = 0;
+    //m_r[dimension * functions_count + function]
+    std::vector<FloatType> m_r;
+    std::vector<FloatType> m_b;
+    std::vector<FloatType> m_w;
+
+    std::size_t functions_count() const { return m_b.size(); }
+
+    template <typename Range>
+    void inner_products(Range const & range, FloatType * products, std::true_type /*sparse*/) const {
+        for (auto it = range.begin(); it != range.end(); ++it) {
+            assert(it.index() < m_dimensions);
+            detail::add_scaled(products, m_r.data() + it.index() * functions_count(),
+                               static_cast<FloatType>(*it), functions_count());
+        }
+    }
+
+    template <typename Range>
+    void inner_products(Range const & range, FloatType * products, std::false_type /*sparse*/) const {
+        assert(std::size_t(boost::size(range)) == m_dimensions);
+        auto r = m_r.data();
+        for (auto && coordinate : range) {
+            detail::add_scaled(products, r, static_cast<FloatType>(coordinate), functions_count());
+            r += functions_count();
+        }
+    }
+
+public:
+    ///serialize
+    template<class Archive>
+    void serialize(Archive & ar, const unsigned int version) {
+        ar & m_dimensions;
+        ar & m_r;
+        ar & m_b;
+        ar & m_w;
+    }
+
+    ///default constructor
+    l_p_hash_function_tuple() = default;
+
+    /**
+     * @brief constructor
+     *
+     * @param funs range of l_p_hash_functions with random vectors of equal sizes
+     */
+    template <typename Funs>
+    explicit l_p_hash_function_tuple(Funs const & funs) {
+        if (boost::empty(funs)) return;
+        m_dimensions = boost::size(boost::begin(funs)->get_r());
+        auto const count = boost::size(funs);
+        m_r.resize(m_dimensions * count);
+        std::size_t i = 0;
+        for (auto const & fun : funs) {
+            assert(std::size_t(boost::size(fun.get_r())) == m_dimensions);
+            for (std::size_t d = 0; d < m_dimensions; ++d) {
+                m_r[d * count + i] = fun.get_r()[d];
+            }
+            m_b.push_back(fun.get_b());
+            m_w.push_back(fun.get_w());
+            ++i;
+        }
+    }
+
+    ///operator==
+    bool operator==(l_p_hash_function_tuple const & other) const {
+        return m_dimensions == other.m_dimensions &&
+               m_r == other.m_r &&
+               m_b == other.m_b &&
+               m_w == other.m_w;
+    }
+
+    /**
+     * @brief operator()
+     *
+     * @tparam Range
+     * @param range Range modeling boost uBLAS VectorExpression concept or random access range,
+     *        sparse uBLAS vectors are evaluated on nonzero coordinates only
+     *
+     * @return vector of hash values
+     */
+    template <typename Range>
+    std::vector<FloatType> operator()(Range &&range) const {
+        std::vector<FloatType> values(functions_count(), FloatType{});
+        inner_products(range, values.data(), data_structures::is_sparse_row<Range>{});
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            values[i] = std::floor((m_b[i] + values[i]) / m_w[i]);
+        }
+        return values;
+    }
+};
+
+/**
+ * @brief Factory class for l_p_hash_function_tuple
+ *
+ * @tparam FunctionGenerator generator of l_p_hash_functions
+ */
+template <typename FunctionGenerator>
+class l_p_hash_function_tuple_generator {
+    FunctionGenerator m_function_generator;
+    unsigned m_hash_functions_per_point;
+    using fun_t = pure_result_of_t<FunctionGenerator()>;
+    using float_t = puretype(std::declval<fun_t>().get_b());
+
+public:
+    /**
+     * @brief constructor
+     *
+     * @param function_generator
+     * @param hash_functions_per_point number of hash functions in single tuple
+     */
+    l_p_hash_function_tuple_generator(FunctionGenerator function_generator,
+                                      unsigned hash_functions_per_point) :
+        m_function_generator(std::move(function_generator)),
+        m_hash_functions_per_point(hash_functions_per_point) {}
+
+    /**
+     * @brief operator()
+     *
+     * @return l_p_hash_function_tuple of m_hash_functions_per_point hash functions
+     */
+    l_p_hash_function_tuple<float_t> operator()() const {
+        std::vector<fun_t> funs;
+        funs.reserve(m_hash_functions_per_point);
+        std::generate_n(std::back_inserter(funs), m_hash_functions_per_point,
+                        std::ref(m_function_generator));
+        return l_p_hash_function_tuple<float_t>(funs);
+    }
+};
+
+/**
+ * @brief make function for l_p_hash_function_tuple_generator
+ *
+ * @tparam FunctionGenerator
+ * @param function_generator generator of l_p_hash_functions
+ * @param hash_functions_per_point number of hash functions in single tuple
+ *
+ * @return
+ */
+template <typename FunctionGenerator>
+auto make_l_p_hash_function_tuple_generator(FunctionGenerator function_generator,
+                                            unsigned hash_functions_per_point) {
+    return l_p_hash_function_tuple_generator<FunctionGenerator>(
+                std::move(function_generator), hash_functions_per_point);
+}
+
 /// Cauchy distribution is 1-stable
 template <typename FloatType = double,
           typename RandomEngine = std::default_random_engine>
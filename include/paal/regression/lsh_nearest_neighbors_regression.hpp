@@ -15,22 +15,30 @@
 #ifndef PAAL_LSH_NEAREST_NEIGHBOURS_REGRESSION_HPP
 #define PAAL_LSH_NEAREST_NEIGHBOURS_REGRESSION_HPP
 
+#include "paal/data_structures/open_addressing_map.hpp"
 #include "paal/data_structures/thread_pool.hpp"
 #include "paal/regression/lsh_functions.hpp"
 #include "paal/utils/accumulate_functors.hpp"
 #include "paal/utils/hash.hpp"
+#include "paal/utils/irange.hpp"
 #include "paal/utils/type_functions.hpp"
-#include "paal/utils/unordered_map_serialization.hpp"
 
+#include <boost/range/algorithm/copy.hpp>
 #include <boost/range/algorithm/transform.hpp>
 #include <boost/range/combine.hpp>
 #include <boost/range/empty.hpp>
+#include <boost/range/has_range_iterator.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <boost/range/size.hpp>
-#include <boost/unordered_map.hpp>
+#include <boost/range/value_type.hpp>
 #include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <stdexcept>
 #include <thread>
 #include <type_traits>
 #include <vector>
@@ -172,6 +180,71 @@ namespace detail {
               Point &&p, detail::lightweight_tag tag) {
         return f(std::forward<Point>(p), tag);
     }
+
+    template <typename HashValue>
+    using is_range_hash_value = std::integral_constant<bool,
+          boost::has_range_const_iterator<std::decay_t<HashValue>>::value>;
+
+    /// type of the elements of the hash values, a hash value is either a range or a single element
+    template <typename HashValue, typename Enable = void>
+    struct lsh_key_element {
+        using type = HashValue;
+    };
+
+    template <typename HashValue>
+    struct lsh_key_element<HashValue, std::enable_if_t<is_range_hash_value<HashValue>::value>> {
+        using type = typename boost::range_value<HashValue>::type;
+    };
+
+    template <typename HashValue>
+    using lsh_key_element_t = typename lsh_key_element<HashValue>::type;
+
+    /// appends elements of the hash value to key and returns its fingerprint
+    template <typename HashForHashValue, typename HashValue, typename Key>
+    std::uint64_t append_lsh_key(HashValue && value, Key & key, std::true_type) {
+        auto const begin = key.size();
+        for (auto && element : value) {
+            key.push_back(element);
+        }
+        return HashForHashValue{}(boost::make_iterator_range(key.begin() + begin, key.end()));
+    }
+
+    template <typename HashForHashValue, typename HashValue, typename Key>
+    std::uint64_t append_lsh_key(HashValue && value, Key & key, std::false_type) {
+        key.push_back(value);
+        return HashForHashValue{}(value);
+    }
+
+    /**
+     * @brief bucket of lsh_nearest_neighbors_regression,
+     * average result of training points with the same hash value
+     * and the position of this hash value in the keys of the pass
+     */
+    struct lsh_bucket {
+        ///average result
+        average_accumulator<> avg;
+        ///index of the first element of the hash value in the keys of the pass
+        std::uint64_t key_begin = 0;
+        ///number of elements of the hash value
+        std::uint64_t key_size = 0;
+
+        ///operator==
+        bool operator==(lsh_bucket const & other) const {
+            return avg == other.avg && key_begin == other.key_begin &&
+                   key_size == other.key_size;
+        }
+
+        ///serialize
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int version) {
+            ar & avg;
+            ar & key_begin;
+            ar & key_size;
+        }
+    };
+
+    ///version of the serialization format of lsh_nearest_neighbors_regression
+    static const unsigned lsh_model_format_version = 1;
 } //! detail
 
 /**
@@ -183,22 +256,37 @@ namespace detail {
  *
  * example file is lsh_nearest_neighbors_regression_example.cpp
  *
+ * The elements of the hash values of each pass are stored in one flat array
+ * of keys. Each hash value is folded by HashForHashValue into a fixed width fingerprint,
+ * which is the key in the flat open addressing map, the buckets with equal fingerprints
+ * are distinguished by the full hash values.
+ *
  * @tparam HashValue return type of functions generated by LshFunctionGenerator object
  * @tparam LshFunctionGenerator type of functor which generates proper LSH functions
- * @tparam HashForHashValue hash type to be used in hash maps
+ * @tparam HashForHashValue hash type used to compute fingerprints of hash values,
+ *         it is applied to the range of the elements of the hash value
+ * @tparam BucketMap map from fingerprints to buckets,
+ *         read only data_structures::open_addressing_map_view can be used for models which cannot be updated
+ * @tparam Keys random access range of the elements of the hash values of one pass
  */
 template <typename HashValue,
           typename LshFun,
           //TODO default value here supposed to be std::hash
-          typename HashForHashValue = range_hash>
+          typename HashForHashValue = range_hash,
+          typename BucketMap = data_structures::open_addressing_map<detail::lsh_bucket, std::uint64_t>,
+          typename Keys = std::vector<detail::lsh_key_element_t<HashValue>>>
 class lsh_nearest_neighbors_regression {
 
     //TODO template param TestResultType
     using res_accu_t = average_accumulator<>;
-    using map_t = boost::unordered_map<HashValue, res_accu_t, HashForHashValue>;
+    using fingerprint_t = std::uint64_t;
+    using map_t = BucketMap;
+    using key_element_t = detail::lsh_key_element_t<HashValue>;
 
-    ///hash maps containing average result for each hash key
+    ///hash maps containing bucket for each hash key fingerprint
     std::vector<map_t> m_hash_maps;
+    ///elements of the hash values of the buckets, one array per pass
+    std::vector<Keys> m_keys;
     ///hash functions
     std::vector<LshFun> m_hashes;
 
@@ -210,7 +298,11 @@ public:
     ///serialization
     template<class Archive>
     void serialize(Archive & ar, const unsigned int version){
+        if (version != detail::lsh_model_format_version) {
+            throw std::runtime_error("unsupported version of the lsh model format");
+        }
         ar & m_hash_maps;
+        ar & m_keys;
         ar & m_hashes;
         ar & m_avg;
     }
@@ -235,7 +327,7 @@ public:
             unsigned passes,
             LshFunctionGenerator &&lsh_function_generator,
             unsigned threads_count = std::thread::hardware_concurrency()) :
-        m_hash_maps(passes) {
+        m_hash_maps(passes), m_keys(passes) {
 
         m_hashes.reserve(passes);
         std::generate_n(std::back_inserter(m_hashes), passes,
@@ -246,11 +338,42 @@ public:
                threads_count);
     }
 
+    /**
+     * @brief constructor from already trained parts of the model
+     *
+     * @param hash_maps maps containing bucket for each hash key fingerprint, one per pass
+     * @param keys elements of the hash values of the buckets, one array per pass
+     * @param hashes hash functions, one per pass
+     * @param avg average result of all training points
+     */
+    lsh_nearest_neighbors_regression(std::vector<map_t> hash_maps,
+                                     std::vector<Keys> keys,
+                                     std::vector<LshFun> hashes,
+                                     average_accumulator<> avg) :
+        m_hash_maps(std::move(hash_maps)), m_keys(std::move(keys)),
+        m_hashes(std::move(hashes)), m_avg(avg) {
+        assert(m_hash_maps.size() == m_hashes.size());
+        assert(m_keys.size() == m_hashes.size());
+    }
+
+    ///hash maps, one per pass
+    std::vector<map_t> const & get_hash_maps() const { return m_hash_maps; }
+
+    ///elements of the hash values of the buckets, one array per pass
+    std::vector<Keys> const & get_keys() const { return m_keys; }
+
+    ///hash functions, one per pass
+    std::vector<LshFun> const & get_hash_functions() const { return m_hashes; }
+
+    ///average result of all training points
+    average_accumulator<> const & get_average() const { return m_avg; }
+
     ///operator==
     bool operator==(lsh_nearest_neighbors_regression const & other) const {
         return m_avg == other.m_avg &&
                m_hashes == other.m_hashes &&
-               m_hash_maps == other.m_hash_maps;
+               m_hash_maps == other.m_hash_maps &&
+               m_keys == other.m_keys;
     }
 
 
@@ -271,10 +394,13 @@ public:
 
         threads.post([&](){ compute_avg(training_results);});
 
-        for (auto &&map_and_fun : boost::combine(m_hash_maps, m_hashes)) {
-            auto &map = boost::get<0>(map_and_fun);
+        for (auto &&pass : boost::combine(m_hash_maps, m_keys, m_hashes)) {
+            auto &map = boost::get<0>(pass);
+            auto &keys = boost::get<1>(pass);
             //fun is passed by value because of efficiency reasons
-            threads.post([&, fun = boost::get<1>(map_and_fun)]() {add_values(fun, map, training_points, training_results);});
+            threads.post([&, fun = boost::get<2>(pass)]() {
+                add_values(fun, map, keys, training_points, training_results);
+            });
         }
         threads.run();
     }
@@ -292,15 +418,18 @@ public:
     void test(TestPoints &&test_points, OutputIterator result) const {
         assert(!m_avg.empty());
 
+        std::vector<key_element_t> key;
         for (auto &&test_point : test_points) {
             average_accumulator<> avg;
-            for(auto && map_and_fun : boost::combine(m_hash_maps, m_hashes)) {
-                auto const &map = boost::get<0>(map_and_fun);
-                auto const &fun = boost::get<1>(map_and_fun);
-                auto got = map.find(detail::call(fun, test_point, detail::lightweight_tag{}),
-                                    HashForHashValue{}, utils::equal_to_unspecified{});
-                if (got != map.end()) {
-                    avg.add_value(got->second.get_average_unsafe());
+            for(auto && pass : boost::combine(m_hash_maps, m_keys, m_hashes)) {
+                auto const &map = boost::get<0>(pass);
+                auto const &keys = boost::get<1>(pass);
+                auto const &fun = boost::get<2>(pass);
+                key.clear();
+                auto fp = append_key(fun, test_point, key);
+                auto got = map.find(fp, same_key(keys, key.begin(), key.end()));
+                if (got) {
+                    avg.add_value(got->avg.get_average_unsafe());
                 }
             }
             *result = avg.get_average(m_avg.get_average());
@@ -308,24 +437,130 @@ public:
         }
     }
 
+    /**
+     * @brief queries model in the batch mode, test points are split into blocks
+     * which are processed by threads_count threads.
+     * For each block, fingerprints of all points in the block are computed
+     * before probing the hash map, so the map of a single pass is probed
+     * by the whole block at once. The results are written in the order of the test points.
+     *
+     * @tparam TestPoints has to be random access range
+     * @tparam OutputIterator
+     * @param test_points
+     * @param result
+     * @param threads_count
+     * @param block_size number of test points processed by a single task
+     */
+    template <typename TestPoints, typename OutputIterator>
+    void test(TestPoints &&test_points, OutputIterator result,
+              unsigned threads_count,
+              std::size_t block_size = default_test_block_size) const {
+        assert(!m_avg.empty());
+        assert(block_size > 0);
+
+        std::size_t const points_count = boost::size(test_points);
+        std::vector<double> predictions(points_count);
+        auto points_begin = boost::begin(test_points);
+
+        thread_pool threads(threads_count);
+        for (std::size_t block_begin = 0; block_begin < points_count; block_begin += block_size) {
+            auto block_end = std::min(block_begin + block_size, points_count);
+            threads.post([&, block_begin, block_end]() {
+                test_block(boost::make_iterator_range(points_begin + block_begin,
+                                                      points_begin + block_end),
+                           predictions.begin() + block_begin);
+            });
+        }
+        threads.run();
+
+        boost::copy(predictions, result);
+    }
+
 private:
 
+    ///default number of test points processed by a single task in the batch mode
+    static const std::size_t default_test_block_size = 1024;
+
+    ///appends elements of the hash value of the point to key, returns fingerprint of the hash value
+    template <typename Point>
+    static fingerprint_t append_key(LshFun const & fun, Point && point,
+                                    std::vector<key_element_t> & key) {
+        auto && value = detail::call(fun, point, detail::lightweight_tag{});
+        return detail::append_lsh_key<HashForHashValue>(
+                value, key, detail::is_range_hash_value<decltype(value)>{});
+    }
+
+    ///predicate accepting the bucket of the hash value with the given elements
+    template <typename PassKeys, typename Iterator>
+    static auto same_key(PassKeys const & keys, Iterator begin, Iterator end) {
+        return [&keys, begin, end](detail::lsh_bucket const & bucket) {
+            // the range check guards against buckets of corrupted mapped models
+            return bucket.key_size == static_cast<std::uint64_t>(end - begin) &&
+                   bucket.key_begin <= keys.size() &&
+                   bucket.key_size <= keys.size() - bucket.key_begin &&
+                   std::equal(begin, end, keys.begin() + bucket.key_begin);
+        };
+    }
+
+    ///computes predictions for one block of test points, pass by pass
+    template <typename Block, typename PredictionIterator>
+    void test_block(Block const & block, PredictionIterator predictions) const {
+        std::vector<average_accumulator<>> avgs(boost::size(block));
+        std::vector<fingerprint_t> block_fingerprints;
+        block_fingerprints.reserve(avgs.size());
+        // elements of the hash values of the block and the ends of the hash values
+        std::vector<key_element_t> block_keys;
+        std::vector<std::size_t> key_ends;
+        key_ends.reserve(avgs.size());
+
+        for (auto && pass : boost::combine(m_hash_maps, m_keys, m_hashes)) {
+            auto const &map = boost::get<0>(pass);
+            auto const &keys = boost::get<1>(pass);
+            auto const &fun = boost::get<2>(pass);
+
+            block_fingerprints.clear();
+            block_keys.clear();
+            key_ends.clear();
+            for (auto && test_point : block) {
+                block_fingerprints.push_back(append_key(fun, test_point, block_keys));
+                key_ends.push_back(block_keys.size());
+            }
+
+            std::size_t key_begin = 0;
+            for (auto i : irange(avgs.size())) {
+                auto got = map.find(block_fingerprints[i],
+                                    same_key(keys, block_keys.begin() + key_begin,
+                                             block_keys.begin() + key_ends[i]));
+                if (got) {
+                    avgs[i].add_value(got->avg.get_average_unsafe());
+                }
+                key_begin = key_ends[i];
+            }
+        }
+
+        for (auto const & avg : avgs) {
+            *predictions = avg.get_average(m_avg.get_average());
+            ++predictions;
+        }
+    }
+
     ///adds values to one hash map
     template <typename Points, typename Results>
-    void add_values(LshFun fun, map_t & map, Points && training_points, Results && training_results) {
+    void add_values(LshFun fun, map_t & map, Keys & keys,
+                    Points && training_points, Results && training_results) {
+        std::vector<key_element_t> key;
         for (auto &&training_point_result : boost::combine(training_points, training_results)) {
             auto && point = boost::get<0>(training_point_result);
             auto && res = boost::get<1>(training_point_result);
-
-            //the return value of this call might be impossible to store in the map
-            auto got = map.find(call(fun, point, detail::lightweight_tag{}),
-                                 HashForHashValue{}, utils::equal_to_unspecified{});
-            if (got != map.end()) {
-                got->second.add_value(res);
-            } else {
-                map[fun(point)].add_value(res);
+            key.clear();
+            auto fp = append_key(fun, point, key);
+            auto bucket = map.insert(fp, same_key(keys, key.begin(), key.end()));
+            if (bucket.second) {
+                bucket.first->key_begin = keys.size();
+                bucket.first->key_size = key.size();
+                keys.insert(keys.end(), key.begin(), key.end());
             }
-
+            bucket.first->avg.add_value(res);
         }
     }
 
@@ -416,4 +651,20 @@ auto make_lsh_nearest_neighbors_regression_tuple_hash(
 
 } //! paal
 
+namespace boost {
+namespace serialization {
+
+/// version of the serialization format of lsh_nearest_neighbors_regression
+template <typename HashValue, typename LshFun, typename HashForHashValue,
+          typename BucketMap, typename Keys>
+struct version<paal::lsh_nearest_neighbors_regression<HashValue, LshFun, HashForHashValue,
+                                                      BucketMap, Keys>> {
+    using type = mpl::int_<paal::detail::lsh_model_format_version>;
+    using tag = mpl::integral_c_tag;
+    BOOST_STATIC_CONSTANT(int, value = version::type::value);
+};
+
+} //! serialization
+} //! boost
+
 #endif // PAAL_LSH_NEAREST_NEIGHBOURS_REGRESSION_HPP
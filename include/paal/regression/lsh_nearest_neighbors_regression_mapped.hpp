@@ -0,0 +1,322 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file lsh_nearest_neighbors_regression_mapped.hpp
+ * @brief flat file format of lsh_nearest_neighbors_regression model,
+ * which can be memory mapped and queried in place
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_LSH_NEAREST_NEIGHBOURS_REGRESSION_MAPPED_HPP
+#define PAAL_LSH_NEAREST_NEIGHBOURS_REGRESSION_MAPPED_HPP
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_SYSTEM_NO_DEPRECATED
+
+#include "paal/data_structures/open_addressing_map.hpp"
+#include "paal/regression/lsh_nearest_neighbors_regression.hpp"
+#include "paal/utils/irange.hpp"
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/iostreams/stream.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace paal {
+
+namespace detail {
+
+/*
+ * Layout of the file (native endianness):
+ *
+ * header | tables directory | hash functions | padding | slots of pass 0 | padding | keys of pass 0 |
+ * padding | slots of pass 1 ...
+ *
+ * Hash functions are small comparing to the bucket tables, so they are stored
+ * as a boost binary archive and deserialized when the model is loaded.
+ * Slots of the bucket tables and the elements of the hash values are stored exactly
+ * as in the memory of the model, every array starts at offset which is multiple
+ * of mapped_model_alignment.
+ */
+
+static const char mapped_model_magic[8] = {'P', 'A', 'A', 'L', 'L', 'S', 'H', '1'};
+static const std::uint64_t mapped_model_version = 2;
+static const std::uint64_t mapped_model_alignment = 64;
+
+struct mapped_model_header {
+    char magic[8];
+    std::uint64_t version;
+    std::uint64_t slot_size;
+    std::uint64_t key_element_size;
+    std::uint64_t passes;
+    double avg_value;
+    std::uint64_t avg_count;
+    std::uint64_t functions_offset;
+    std::uint64_t functions_size;
+};
+
+struct mapped_model_table {
+    std::uint64_t offset;
+    std::uint64_t capacity;
+    std::uint64_t size;
+    std::uint64_t keys_offset;
+    std::uint64_t keys_size;
+};
+
+inline std::uint64_t align_mapped_model_offset(std::uint64_t offset) {
+    return (offset + mapped_model_alignment - 1) / mapped_model_alignment * mapped_model_alignment;
+}
+
+/// checks if count elements of size element_size starting at offset lie within the file,
+/// written so that none of the computations can overflow
+inline bool mapped_model_range_fits(std::uint64_t offset, std::uint64_t count,
+                                    std::uint64_t element_size, std::uint64_t file_size) {
+    assert(element_size > 0);
+    return offset <= file_size && count <= (file_size - offset) / element_size;
+}
+
+/// checks the directory entry of a single bucket table
+inline bool mapped_model_table_valid(mapped_model_table const & table,
+                                     std::uint64_t slot_size, std::uint64_t key_element_size,
+                                     std::uint64_t file_size) {
+    return table.offset % mapped_model_alignment == 0 &&
+           table.keys_offset % mapped_model_alignment == 0 &&
+           (table.capacity & (table.capacity - 1)) == 0 &&
+           // linear probing needs at least one empty slot
+           (table.capacity == 0 ? table.size == 0 : table.size < table.capacity) &&
+           mapped_model_range_fits(table.offset, table.capacity, slot_size, file_size) &&
+           mapped_model_range_fits(table.keys_offset, table.keys_size, key_element_size, file_size);
+}
+
+/// read only array stored in a memory mapped file
+template <typename T>
+class mapped_array {
+    T const * m_begin = nullptr;
+    std::size_t m_size = 0;
+    std::shared_ptr<void const> m_owner;
+
+public:
+    ///constructor
+    mapped_array() = default;
+
+    ///constructor, the memory is kept alive by the owner pointer
+    mapped_array(T const * begin, std::size_t size, std::shared_ptr<void const> owner) :
+        m_begin(begin), m_size(size), m_owner(std::move(owner)) {}
+
+    ///begin
+    T const * begin() const { return m_begin; }
+
+    ///end
+    T const * end() const { return m_begin + m_size; }
+
+    ///size
+    std::size_t size() const { return m_size; }
+
+    ///operator==
+    bool operator==(mapped_array const & other) const {
+        return m_size == other.m_size && std::equal(begin(), end(), other.begin());
+    }
+};
+
+template <typename Model> struct mapped_lsh_nearest_neighbors_regression;
+
+template <typename HashValue, typename LshFun, typename HashForHashValue,
+          typename BucketMap, typename Keys>
+struct mapped_lsh_nearest_neighbors_regression<
+    lsh_nearest_neighbors_regression<HashValue, LshFun, HashForHashValue, BucketMap, Keys>> {
+    using slot_t = typename BucketMap::slot;
+    using key_t = decltype(slot_t::key);
+    using value_t = decltype(slot_t::value);
+    using key_element_t = range_to_elem_t<Keys>;
+    using map_t = data_structures::open_addressing_map_view<value_t, key_t>;
+    using keys_t = mapped_array<key_element_t>;
+    using type = lsh_nearest_neighbors_regression<HashValue, LshFun, HashForHashValue, map_t, keys_t>;
+};
+
+} //! detail
+
+/// type of the memory mapped version of the lsh_nearest_neighbors_regression Model
+template <typename Model>
+using mapped_lsh_nearest_neighbors_regression_t =
+    typename detail::mapped_lsh_nearest_neighbors_regression<Model>::type;
+
+/**
+ * @brief saves model in the flat format,
+ * which can be loaded by load_mapped_lsh_nearest_neighbors_regression
+ *
+ * @tparam Model
+ * @param model
+ * @param path
+ */
+template <typename Model>
+void save_mapped_lsh_nearest_neighbors_regression(Model const & model, std::string const & path) {
+    using mapped_t = detail::mapped_lsh_nearest_neighbors_regression<Model>;
+    using slot_t = typename mapped_t::slot_t;
+    using key_element_t = typename mapped_t::key_element_t;
+    static_assert(std::is_trivially_copyable<slot_t>::value,
+                  "slots of the bucket maps have to be trivially copyable");
+    static_assert(std::is_trivially_copyable<key_element_t>::value,
+                  "elements of the hash values have to be trivially copyable");
+
+    std::ostringstream functions_stream;
+    {
+        boost::archive::binary_oarchive oa(functions_stream);
+        oa << model.get_hash_functions();
+    }
+    auto const functions = functions_stream.str();
+
+    auto const & maps = model.get_hash_maps();
+    auto const & keys = model.get_keys();
+    detail::mapped_model_header header;
+    std::memcpy(header.magic, detail::mapped_model_magic, sizeof(header.magic));
+    header.version = detail::mapped_model_version;
+    header.slot_size = sizeof(slot_t);
+    header.key_element_size = sizeof(key_element_t);
+    header.passes = maps.size();
+    header.avg_value = model.get_average().get_accumulated_value();
+    header.avg_count = model.get_average().get_count();
+    header.functions_offset = sizeof(header) + maps.size() * sizeof(detail::mapped_model_table);
+    header.functions_size = functions.size();
+
+    std::vector<detail::mapped_model_table> tables;
+    auto offset = header.functions_offset + header.functions_size;
+    for (auto i : irange(maps.size())) {
+        auto const slots_offset = detail::align_mapped_model_offset(offset);
+        auto const keys_offset = detail::align_mapped_model_offset(
+                slots_offset + maps[i].capacity() * sizeof(slot_t));
+        tables.push_back({slots_offset, maps[i].capacity(), maps[i].size(),
+                          keys_offset, keys[i].size()});
+        offset = keys_offset + keys[i].size() * sizeof(key_element_t);
+    }
+
+    std::ofstream ofs(path, std::ios::binary);
+    ofs.write(reinterpret_cast<char const *>(&header), sizeof(header));
+    ofs.write(reinterpret_cast<char const *>(tables.data()), tables.size() * sizeof(detail::mapped_model_table));
+    ofs.write(functions.data(), functions.size());
+    auto pad_to = [&](std::uint64_t offset) {
+        std::string padding(offset - static_cast<std::uint64_t>(ofs.tellp()), '\0');
+        ofs.write(padding.data(), padding.size());
+    };
+    for (auto i : irange(maps.size())) {
+        pad_to(tables[i].offset);
+        ofs.write(reinterpret_cast<char const *>(maps[i].slots().data()),
+                  tables[i].capacity * sizeof(slot_t));
+        pad_to(tables[i].keys_offset);
+        ofs.write(reinterpret_cast<char const *>(keys[i].data()),
+                  tables[i].keys_size * sizeof(key_element_t));
+    }
+    if (!ofs) {
+        throw std::runtime_error("could not write the model to " + path);
+    }
+}
+
+/**
+ * @brief loads model saved by save_mapped_lsh_nearest_neighbors_regression.
+ * The file is memory mapped and the bucket maps are queried in place,
+ * so loading time does not depend on the number of buckets and
+ * the pages of the file are shared between processes using the same model.
+ * The returned model can be tested but cannot be updated.
+ * Throws std::runtime_error if the header or the tables directory is malformed
+ * or points outside of the file. Contents of the bucket slots are not validated
+ * (it would make loading time linear), a bucket whose hash value lies outside of
+ * the keys array never matches a query and a lookup in a table without empty
+ * slots stops after probing all of them.
+ *
+ * @tparam Model type of the saved model
+ * @param path
+ *
+ * @return model of type mapped_lsh_nearest_neighbors_regression_t<Model>
+ */
+template <typename Model>
+auto load_mapped_lsh_nearest_neighbors_regression(std::string const & path) {
+    using mapped_t = detail::mapped_lsh_nearest_neighbors_regression<Model>;
+    using slot_t = typename mapped_t::slot_t;
+    using key_element_t = typename mapped_t::key_element_t;
+    using map_t = typename mapped_t::map_t;
+    using keys_t = typename mapped_t::keys_t;
+    using lsh_fun_t = range_to_elem_t<decltype(std::declval<Model>().get_hash_functions())>;
+
+    auto file = std::make_shared<boost::iostreams::mapped_file_source>(path);
+    char const * data = file->data();
+    auto const file_size = file->size();
+
+    detail::mapped_model_header header;
+    if (file_size < sizeof(header)) {
+        throw std::runtime_error(path + " is not a mapped lsh model");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, detail::mapped_model_magic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error(path + " is not a mapped lsh model");
+    }
+    if (header.version != detail::mapped_model_version) {
+        throw std::runtime_error(path + " has unsupported version of the mapped lsh model format");
+    }
+    if (header.slot_size != sizeof(slot_t) || header.key_element_size != sizeof(key_element_t)) {
+        throw std::runtime_error(path + " is not a mapped lsh model of the given type");
+    }
+
+    if (!detail::mapped_model_range_fits(sizeof(header), header.passes,
+                                         sizeof(detail::mapped_model_table), file_size) ||
+        !detail::mapped_model_range_fits(header.functions_offset, header.functions_size, 1, file_size)) {
+        throw std::runtime_error(path + " is truncated or corrupted");
+    }
+
+    std::vector<detail::mapped_model_table> tables(header.passes);
+    std::memcpy(tables.data(), data + sizeof(header), tables.size() * sizeof(detail::mapped_model_table));
+    for (auto const & table : tables) {
+        if (!detail::mapped_model_table_valid(table, sizeof(slot_t), sizeof(key_element_t), file_size)) {
+            throw std::runtime_error(path + " is truncated or corrupted");
+        }
+    }
+
+    std::vector<lsh_fun_t> hash_functions;
+    try {
+        boost::iostreams::stream<boost::iostreams::array_source>
+            functions_stream(data + header.functions_offset, header.functions_size);
+        boost::archive::binary_iarchive ia(functions_stream);
+        ia >> hash_functions;
+    } catch (boost::archive::archive_exception const &) {
+        throw std::runtime_error(path + " has corrupted hash functions");
+    }
+    if (hash_functions.size() != tables.size()) {
+        throw std::runtime_error(path + " has corrupted hash functions");
+    }
+
+    std::vector<map_t> maps;
+    std::vector<keys_t> keys;
+    maps.reserve(tables.size());
+    keys.reserve(tables.size());
+    for (auto const & table : tables) {
+        maps.emplace_back(reinterpret_cast<slot_t const *>(data + table.offset),
+                          table.capacity, table.size, file);
+        keys.emplace_back(reinterpret_cast<key_element_t const *>(data + table.keys_offset),
+                          table.keys_size, file);
+    }
+
+    return mapped_lsh_nearest_neighbors_regression_t<Model>(
+                std::move(maps), std::move(keys), std::move(hash_functions),
+                average_accumulator<>(header.avg_value, header.avg_count));
+}
+
+} //! paal
+
+#endif // PAAL_LSH_NEAREST_NEIGHBOURS_REGRESSION_MAPPED_HPP
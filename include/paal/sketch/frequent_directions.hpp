@@ -15,19 +15,27 @@
 #ifndef PAAL_FREQUENT_DIRECTIONS_HPP
 #define PAAL_FREQUENT_DIRECTIONS_HPP
 
+#include "paal/data_structures/thread_pool.hpp"
 #include "paal/data_structures/ublas_traits.hpp"
 #include "paal/utils/irange.hpp"
 
 #include <boost/numeric/bindings/lapack/gesvd.hpp>
+#include <boost/numeric/bindings/lapack/syevd.hpp>
+#include <boost/numeric/bindings/lapack/workspace.hpp>
 #include <boost/numeric/ublas/detail/matrix_assign.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/matrix_expression.hpp>
 
 #include <boost/range/algorithm/copy.hpp>
 #include <boost/range/distance.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <boost/range/size.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
+#include <vector>
 
 namespace paal {
 
@@ -79,6 +87,21 @@ void copy_row_to_matrix(InputRow &&input_row, DestRow &dest_matrix_row) {
 
 } // detail
 
+/**
+ * @brief compress phase computes the full singular value decomposition of the sketch (LAPACK gesvd)
+ */
+struct svd_compress_tag {};
+
+/**
+ * @brief compress phase computes the eigendecomposition of the smaller Gram matrix
+ * of the sketch (LAPACK syevd), so left singular vectors are never computed.
+ *
+ * Squared singular values are computed with absolute error of order
+ * machine epsilon times the largest squared singular value,
+ * which is negligible comparing to the approximation error of the sketch.
+ */
+struct gram_compress_tag {};
+
 /**
  * @brief Represents sketch of matrix
  *
@@ -87,8 +110,10 @@ void copy_row_to_matrix(InputRow &&input_row, DestRow &dest_matrix_row) {
  *
  * complete example is frequent_directions_example.cpp
  * @tparam Matrix
+ * @tparam CompressTag svd_compress_tag or gram_compress_tag,
+ * the faster one depends on the sketch size, see frequent_directions_compress_long_test.cpp
  */
-template <typename Matrix>
+template <typename Matrix, typename CompressTag = svd_compress_tag>
 class frequent_directions {
     Matrix m_sketch;
     std::size_t m_actual_size;
@@ -97,6 +122,118 @@ class frequent_directions {
     using matrix_types = data_structures::matrix_type_traits<Matrix>;
     using coordinate_t = typename matrix_types::coordinate_t;
 
+    ///empty sketch with the same dimensions and compress size
+    frequent_directions empty_copy() const {
+        Matrix matrix{matrix_types::num_rows(m_sketch),
+                      matrix_types::num_columns(m_sketch), coordinate_t{}};
+        return frequent_directions{std::move(matrix), m_compress_size};
+    }
+
+    void compress(svd_compress_tag) {
+        auto rows_count = matrix_types::num_rows(m_sketch);
+        auto columns_count = matrix_types::num_columns(m_sketch);
+        auto min_dimension = std::min(rows_count, columns_count);
+
+        typename matrix_types::matrix_column_major_t u{rows_count,min_dimension}, vt{min_dimension,columns_count};
+        typename matrix_types::vector_t sigma{min_dimension};
+
+        typename matrix_types::matrix_column_major_t sketch{std::move(m_sketch)};
+        boost::numeric::bindings::lapack::gesvd(sketch, sigma, u, vt);
+
+        coordinate_t const delta = m_compress_size < min_dimension ? sigma[m_compress_size] * sigma[m_compress_size] : coordinate_t{};
+
+        for (auto &sigma_i : sigma) {
+            sigma_i = std::sqrt(std::max(sigma_i * sigma_i - delta, coordinate_t{}));
+        }
+
+        typename matrix_types::matrix_diagonal_t s_diagonal{rows_count, min_dimension, 0, 0, std::move(sigma.data())};
+        m_sketch = boost::numeric::ublas::prod(s_diagonal, vt);
+    }
+
+    // Let B be the nonzero rows of the sketch.
+    // If B has at least as many rows as columns, eigenvectors of B^T B are
+    // the right singular vectors v_i of B. Otherwise eigenvectors of B B^T are
+    // the left singular vectors u_i of B and v_i = B^T u_i / sigma_i.
+    // Eigenvalues of both matrices are squared singular values sigma_i^2.
+    void compress(gram_compress_tag) {
+        auto rows_count = matrix_types::num_rows(m_sketch);
+        auto columns_count = matrix_types::num_columns(m_sketch);
+        auto const nonzero_rows = m_actual_size;
+        bool const right_gram = columns_count <= nonzero_rows;
+        auto const n = std::min(nonzero_rows, columns_count);
+
+        Matrix result{rows_count, columns_count, coordinate_t{}};
+        if (n == 0) {
+            m_sketch = std::move(result);
+            return;
+        }
+
+        //rows of the sketch are contiguous, only the upper triangle is used by syevd
+        auto sketch_row = [&](std::size_t k) { return &m_sketch(k, 0); };
+        typename matrix_types::matrix_column_major_t gram{n, n, coordinate_t{}};
+        if (right_gram) {
+            for (auto k : irange(nonzero_rows)) {
+                auto const b_k = sketch_row(k);
+                for (auto j : irange(n)) {
+                    auto const gram_j = &gram(0, j);
+                    auto const b_kj = b_k[j];
+                    for (std::size_t i = 0; i <= j; ++i) {
+                        gram_j[i] += b_k[i] * b_kj;
+                    }
+                }
+            }
+        } else {
+            for (auto j : irange(n)) {
+                auto const b_j = sketch_row(j);
+                for (std::size_t i = 0; i <= j; ++i) {
+                    auto const b_i = sketch_row(i);
+                    coordinate_t dot{};
+                    for (auto c : irange(columns_count)) {
+                        dot += b_i[c] * b_j[c];
+                    }
+                    gram(i, j) = dot;
+                }
+            }
+        }
+
+        typename matrix_types::vector_t eigenvalues{n};
+        boost::numeric::bindings::lapack::syevd('V', 'U', gram, eigenvalues,
+                boost::numeric::bindings::lapack::optimal_workspace());
+
+        //eigenvalues are in ascending order
+        auto sigma_squared = [&](std::size_t i) {
+            return std::max(eigenvalues[n - 1 - i], coordinate_t{});
+        };
+        coordinate_t const delta = m_compress_size < n ? sigma_squared(m_compress_size) : coordinate_t{};
+        coordinate_t const negligible = sigma_squared(0) * n * std::numeric_limits<coordinate_t>::epsilon();
+
+        for (auto i : irange(n)) {
+            auto const sigma_i_squared = sigma_squared(i);
+            auto const shrunk = sigma_i_squared - delta;
+            if (shrunk <= coordinate_t{} || sigma_i_squared <= negligible) {
+                break;
+            }
+            auto const eigenvector = &gram(0, n - 1 - i);
+            auto const result_row = &result(i, 0);
+            if (right_gram) {
+                auto const scale = std::sqrt(shrunk);
+                for (auto c : irange(columns_count)) {
+                    result_row[c] = scale * eigenvector[c];
+                }
+            } else {
+                auto const scale = std::sqrt(shrunk / sigma_i_squared);
+                for (auto k : irange(n)) {
+                    auto const b_k = sketch_row(k);
+                    auto const coefficient = scale * eigenvector[k];
+                    for (auto c : irange(columns_count)) {
+                        result_row[c] += coefficient * b_k[c];
+                    }
+                }
+            }
+        }
+        m_sketch = std::move(result);
+    }
+
 public:
     ///serialize
     template<class Archive>
@@ -148,7 +285,6 @@ public:
         detail::copy_row_to_matrix(std::forward<InputRow>(input_row), dest_row);
     }
 
-    //TODO add number of threads
     ///Adds new rows.
     template <typename RowRange>
     void update_range(RowRange&& row_range) {
@@ -157,30 +293,78 @@ public:
     }
 
     /**
-     * @brief Compress sketch.
+     * @brief Adds new rows using threads_count threads.
      *
-     * After compress phase sketch contains m_compress_size nonzero rows.
+     * The range is split into threads_count chunks, every thread computes
+     * a partial sketch of one chunk, then the partial sketches are merged
+     * pairwise in ceil(log(threads_count)) parallel rounds.
+     * Approximation guarantees are the same as for update_range(row_range).
+     *
+     * @tparam RowRange random access range of rows
+     * @param row_range
+     * @param threads_count
      */
-    void compress() {
-        auto rows_count = matrix_types::num_rows(m_sketch);
-        auto columns_count = matrix_types::num_columns(m_sketch);
-        auto min_dimension = std::min(rows_count, columns_count);
+    template <typename RowRange>
+    void update_range(RowRange&& row_range, unsigned threads_count) {
+        std::size_t const rows_count = boost::size(row_range);
+        std::size_t const chunks_count = std::min<std::size_t>(threads_count, rows_count);
+        if (chunks_count <= 1) {
+            update_range(std::forward<RowRange>(row_range));
+            return;
+        }
 
-        typename matrix_types::matrix_column_major_t u{rows_count,min_dimension}, vt{min_dimension,columns_count};
-        typename matrix_types::vector_t sigma{min_dimension};
+        std::vector<frequent_directions> sketches;
+        sketches.reserve(chunks_count);
+        sketches.push_back(std::move(*this));
+        for (std::size_t i = 1; i < chunks_count; ++i) {
+            sketches.push_back(sketches.front().empty_copy());
+        }
 
-        typename matrix_types::matrix_column_major_t sketch{std::move(m_sketch)};
-        boost::numeric::bindings::lapack::gesvd(sketch, sigma, u, vt);
+        auto begin = std::begin(row_range);
+        thread_pool update_threads(chunks_count);
+        for (auto i : irange(chunks_count)) {
+            update_threads.post([&, i]() {
+                sketches[i].update_range(boost::make_iterator_range(
+                    begin + rows_count * i / chunks_count,
+                    begin + rows_count * (i + 1) / chunks_count));
+            });
+        }
+        update_threads.run();
+
+        for (std::size_t step = 1; step < chunks_count; step *= 2) {
+            thread_pool merge_threads((chunks_count + step - 1) / (2 * step));
+            for (std::size_t i = 0; i + step < chunks_count; i += 2 * step) {
+                merge_threads.post([&, i]() { sketches[i].merge(sketches[i + step]); });
+            }
+            merge_threads.run();
+        }
 
-        coordinate_t const delta = m_compress_size < min_dimension ? sigma[m_compress_size] * sigma[m_compress_size] : coordinate_t{};
+        *this = std::move(sketches.front());
+    }
 
-        for (auto &sigma_i : sigma) {
-            sigma_i = std::sqrt(std::max(sigma_i * sigma_i - delta, coordinate_t{}));
+    /**
+     * @brief Merges other sketch into this one.
+     *
+     * Nonzero rows of the other sketch are added as new rows, so the result
+     * is a sketch of the rows added to both sketches (with the compress size of this sketch).
+     * Sketches computed independently (e.g. on different machines) can be combined this way.
+     *
+     * @param other sketch with the same number of columns
+     */
+    void merge(frequent_directions const & other) {
+        assert(matrix_types::num_columns(m_sketch) == matrix_types::num_columns(other.m_sketch));
+        for (auto i : irange(other.m_actual_size)) {
+            update_row(boost::numeric::ublas::row(other.m_sketch, i));
         }
+    }
 
-        typename matrix_types::matrix_diagonal_t s_diagonal{rows_count, min_dimension, 0, 0, std::move(sigma.data())};
-        m_sketch = boost::numeric::ublas::prod(s_diagonal, vt);
-
+    /**
+     * @brief Compress sketch.
+     *
+     * After compress phase sketch contains m_compress_size nonzero rows.
+     */
+    void compress() {
+        compress(CompressTag{});
         m_actual_size = m_compress_size;
     }
 
@@ -196,30 +380,30 @@ public:
 
 
 ///make for frequent_directions
-template <typename Matrix>
+template <typename Matrix, typename CompressTag = svd_compress_tag>
 auto make_frequent_directions(Matrix matrix) {
     std::size_t const compress_size = data_structures::matrix_type_traits<Matrix>::num_rows(matrix) / 2;
-    return frequent_directions<Matrix>{std::move(matrix), compress_size};
+    return frequent_directions<Matrix, CompressTag>{std::move(matrix), compress_size};
 }
 
 ///make for frequent_directions with compress_size
-template <typename Matrix>
+template <typename Matrix, typename CompressTag = svd_compress_tag>
 auto make_frequent_directions(Matrix matrix, std::size_t const compress_size) {
-    return frequent_directions<Matrix>{std::move(matrix), compress_size};
+    return frequent_directions<Matrix, CompressTag>{std::move(matrix), compress_size};
 }
 
 ///make for frequent_directions using default matrix
-template <typename CoordinateType>
+template <typename CoordinateType, typename CompressTag = svd_compress_tag>
 auto make_frequent_directions(std::size_t rows_count, std::size_t columns_count) {
     boost::numeric::ublas::matrix<CoordinateType> matrix{rows_count, columns_count, CoordinateType{}};
-    return frequent_directions<boost::numeric::ublas::matrix<CoordinateType>>{std::move(matrix), rows_count / 2};
+    return frequent_directions<boost::numeric::ublas::matrix<CoordinateType>, CompressTag>{std::move(matrix), rows_count / 2};
 }
 
 ///make for frequent_directions using default matrix and compress_size
-template <typename CoordinateType>
+template <typename CoordinateType, typename CompressTag = svd_compress_tag>
 auto make_frequent_directions(std::size_t rows_count, std::size_t columns_count, std::size_t const compress_size) {
     boost::numeric::ublas::matrix<CoordinateType> matrix{rows_count, columns_count, CoordinateType{}};
-    return frequent_directions<boost::numeric::ublas::matrix<CoordinateType>>{std::move(matrix), compress_size};
+    return frequent_directions<boost::numeric::ublas::matrix<CoordinateType>, CompressTag>{std::move(matrix), compress_size};
 }
 
 } // paal
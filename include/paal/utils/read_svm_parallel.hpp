@@ -0,0 +1,408 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file read_svm_parallel.hpp
+ * @brief multithreaded reader of svm files into compressed sparse rows
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#ifndef PAAL_READ_SVM_PARALLEL_HPP
+#define PAAL_READ_SVM_PARALLEL_HPP
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_SYSTEM_NO_DEPRECATED
+
+#include "paal/data_structures/mapped_file.hpp"
+#include "paal/data_structures/thread_pool.hpp"
+#include "paal/utils/assign_updates.hpp"
+#include "paal/utils/functors.hpp"
+#include "paal/utils/irange.hpp"
+
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace paal {
+
+/**
+ * @brief svm rows stored in the compressed sparse row format.
+ * Features of row i are stored on positions [row_starts[i], row_starts[i + 1])
+ * of feature_ids and values, in the order of the input.
+ *
+ * @tparam ValueType
+ * @tparam ResultType
+ * @tparam FeatureIdType
+ */
+template <typename ValueType = double,
+          typename ResultType = int,
+          typename FeatureIdType = std::size_t>
+struct svm_csr_rows {
+    ///beginnings of rows in feature_ids and values, has size() + 1 elements
+    std::vector<std::size_t> row_starts = std::vector<std::size_t>(1, 0);
+    ///feature ids of all rows
+    std::vector<FeatureIdType> feature_ids;
+    ///feature values of all rows
+    std::vector<ValueType> values;
+    ///results of rows (converted to 0 and 1)
+    std::vector<ResultType> results;
+
+    ///number of rows
+    std::size_t size() const { return results.size(); }
+
+    ///feature ids of the given row
+    boost::iterator_range<FeatureIdType const *> get_feature_ids(std::size_t row) const {
+        return boost::make_iterator_range(feature_ids.data() + row_starts[row],
+                                          feature_ids.data() + row_starts[row + 1]);
+    }
+
+    ///feature values of the given row
+    boost::iterator_range<ValueType const *> get_values(std::size_t row) const {
+        return boost::make_iterator_range(values.data() + row_starts[row],
+                                          values.data() + row_starts[row + 1]);
+    }
+};
+
+namespace detail {
+
+inline bool is_svm_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline char const * skip_svm_spaces(char const * it, char const * end) {
+    while (it != end && is_svm_space(*it)) ++it;
+    return it;
+}
+
+/**
+ * @brief parses integer in the range [it, end), moves it after the parsed number
+ *
+ * @return false if there is no number or the number does not fit in IntType
+ */
+template <typename IntType>
+bool parse_svm_integer(char const * &it, char const * end, IntType &value) {
+    static_assert(std::is_integral<IntType>::value, "IntType has to be integral");
+    using unsigned_t = typename std::make_unsigned<IntType>::type;
+    bool negative = false;
+    if (it != end && (*it == '-' || *it == '+')) {
+        negative = (*it == '-');
+        if (negative && std::is_unsigned<IntType>::value) return false;
+        ++it;
+    }
+    if (it == end || !is_digit(*it)) return false;
+    //magnitude of the minimal value of signed type is greater by one than the maximal value
+    unsigned_t const limit = unsigned_t(std::numeric_limits<IntType>::max()) + (negative ? 1 : 0);
+    unsigned_t result{};
+    for (; it != end && is_digit(*it); ++it) {
+        unsigned_t const digit = *it - '0';
+        if (result > (limit - digit) / 10) return false;
+        result = result * 10 + digit;
+    }
+    if (negative && result > 0) {
+        //result - 1 fits in IntType even for the minimal value
+        value = -IntType(result - 1) - 1;
+    } else {
+        value = IntType(result);
+    }
+    return true;
+}
+
+/**
+ * @brief parses floating point number in the range [it, end), moves it after the parsed number.
+ *
+ * Numbers with at most 19 significant digits and small exponents are computed exactly
+ * (Clinger's fast path), other numbers are passed to strtod.
+ *
+ * @return false if there is no number
+ */
+template <typename FloatType>
+bool parse_svm_float(char const * &it, char const * end, FloatType &value) {
+    static const double powers_of_10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                          1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                          1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    static const int max_exact_power = 22;
+    static const int max_mantissa_digits = 19;
+
+    auto const begin = it;
+    bool negative = false;
+    if (it != end && (*it == '-' || *it == '+')) {
+        negative = (*it == '-');
+        ++it;
+    }
+
+    std::uint64_t mantissa = 0;
+    int mantissa_digits = 0;
+    int exponent = 0;
+    bool any_digit = false;
+    bool exact = true;
+    auto add_digit = [&](char c, int exponent_change) {
+        any_digit = true;
+        if (mantissa == 0 && c == '0') {
+            exponent += exponent_change < 0 ? -1 : 0;
+            return;
+        }
+        if (mantissa_digits < max_mantissa_digits) {
+            mantissa = mantissa * 10 + (c - '0');
+            ++mantissa_digits;
+            exponent += exponent_change;
+        } else {
+            exact = false;
+            exponent += exponent_change + 1;
+        }
+    };
+
+    for (; it != end && is_digit(*it); ++it) add_digit(*it, 0);
+    if (it != end && *it == '.') {
+        ++it;
+        for (; it != end && is_digit(*it); ++it) add_digit(*it, -1);
+    }
+    if (!any_digit) {
+        it = begin;
+        return false;
+    }
+    if (it != end && (*it == 'e' || *it == 'E')) {
+        ++it;
+        int exponent_value;
+        if (!parse_svm_integer(it, end, exponent_value)) {
+            it = begin;
+            return false;
+        }
+        exponent += exponent_value;
+    }
+
+    if (exact && mantissa <= (std::uint64_t(1) << 53) &&
+            exponent >= -max_exact_power && exponent <= max_exact_power) {
+        double result = static_cast<double>(mantissa);
+        result = exponent < 0 ? result / powers_of_10[-exponent] : result * powers_of_10[exponent];
+        value = static_cast<FloatType>(negative ? -result : result);
+        return true;
+    }
+
+    //slow path, the mapped file is not null terminated, so the number is copied
+    std::string number(begin, it);
+    value = static_cast<FloatType>(std::strtod(number.c_str(), nullptr));
+    return true;
+}
+
+/**
+ * @brief parses single svm line (without the new line character) into rows
+ *
+ * @return false if the line has bad format or feature id not smaller than dimensions
+ */
+template <typename ValueType, typename ResultType, typename FeatureIdType>
+bool parse_svm_line(char const * it, char const * end,
+                    std::size_t dimensions,
+                    svm_csr_rows<ValueType, ResultType, FeatureIdType> &rows,
+                    std::size_t &max_dimensions) {
+    ResultType result{};
+    bool out_of_bounds = false;
+    it = skip_svm_spaces(it, end);
+    bool correct = parse_svm_integer(it, end, result);
+    rows.results.push_back(result == 1 ? 1 : 0);
+
+    while (correct) {
+        it = skip_svm_spaces(it, end);
+        if (it == end) break;
+
+        FeatureIdType feature_id;
+        ValueType value;
+        correct = parse_svm_integer(it, end, feature_id) && it != end && *it == ':';
+        if (!correct) break;
+        it = skip_svm_spaces(it + 1, end);
+        correct = parse_svm_float(it, end, value) && (it == end || is_svm_space(*it));
+        if (!correct) break;
+
+        rows.feature_ids.push_back(feature_id);
+        rows.values.push_back(value);
+        assign_max(max_dimensions, std::size_t(feature_id) + 1);
+        out_of_bounds |= std::size_t(feature_id) >= dimensions;
+    }
+    rows.row_starts.push_back(rows.feature_ids.size());
+    return correct && !out_of_bounds;
+}
+
+///number of hardware threads, hardware_concurrency returns 0 if it is unknown
+inline unsigned default_svm_threads_count() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+template <typename ValueType, typename ResultType, typename FeatureIdType>
+void pop_svm_row(svm_csr_rows<ValueType, ResultType, FeatureIdType> &rows) {
+    rows.row_starts.pop_back();
+    rows.results.pop_back();
+    rows.feature_ids.resize(rows.row_starts.back());
+    rows.values.resize(rows.row_starts.back());
+}
+
+} //! detail
+
+/**
+ * @brief Reads svm rows (format as in detail::svm_row::operator>>()) from the memory,
+ * the data is split into threads_count chunks parsed in parallel.
+ * The rows are returned in the input order.
+ *
+ * Row with bad format, or with feature id greater or equal to dimensions,
+ * is passed to should_ignore_bad_row together with the offset of the row
+ * from the beginning of the data. If should_ignore_bad_row returns true,
+ * the row is skipped, otherwise the successfully parsed prefix of the row is kept.
+ * Calls of should_ignore_bad_row are serialized, so it does not have to be thread safe.
+ *
+ * @tparam ValueType
+ * @tparam ResultType
+ * @tparam FeatureIdType
+ * @tparam ShouldIgnoreBadRow
+ * @param data
+ * @param data_size
+ * @param dimensions
+ * @param max_dimensions updated with maximal feature id + 1 of the returned rows
+ * @param should_ignore_bad_row functor (std::string const & line, std::size_t offset) -> bool
+ * @param threads_count has to be positive, std::invalid_argument is thrown otherwise
+ *
+ * @return svm_csr_rows
+ */
+template <typename ValueType = double,
+          typename ResultType = int,
+          typename FeatureIdType = std::size_t,
+          typename ShouldIgnoreBadRow = utils::always_false>
+auto read_svm_parallel(char const * data, std::size_t data_size,
+                       std::size_t dimensions,
+                       std::size_t &max_dimensions,
+                       ShouldIgnoreBadRow &&should_ignore_bad_row = ShouldIgnoreBadRow{},
+                       unsigned threads_count = detail::default_svm_threads_count()) {
+    using rows_t = svm_csr_rows<ValueType, ResultType, FeatureIdType>;
+    if (threads_count == 0) {
+        throw std::invalid_argument("read_svm_parallel needs at least one thread");
+    }
+
+    std::vector<rows_t> chunks(threads_count);
+    std::vector<std::size_t> chunks_max_dimensions(threads_count, max_dimensions);
+    std::mutex bad_row_mutex;
+
+    {
+        thread_pool threads(threads_count);
+        for (auto i : irange(threads_count)) {
+            threads.post([&, i]() {
+                auto &rows = chunks[i];
+                //average svm feature takes more than 4 characters
+                auto const expected_features = data_size / threads_count / 4;
+                rows.feature_ids.reserve(expected_features);
+                rows.values.reserve(expected_features);
+
+                data_structures::mapped_file chunk(data, data_size, i, threads_count);
+                while (!chunk.eof() && !chunk.end_of_chunk()) {
+                    auto const offset = chunk.offset();
+                    auto line = chunk.get_line_range();
+                    auto row_max_dimensions = chunks_max_dimensions[i];
+                    if (detail::parse_svm_line(line.begin(), line.end(), dimensions,
+                                               rows, row_max_dimensions)) {
+                        chunks_max_dimensions[i] = row_max_dimensions;
+                        continue;
+                    }
+
+                    bool ignore;
+                    {
+                        std::lock_guard<std::mutex> lock(bad_row_mutex);
+                        ignore = should_ignore_bad_row(std::string(line.begin(), line.end()), offset);
+                    }
+                    if (ignore) {
+                        detail::pop_svm_row(rows);
+                    } else {
+                        chunks_max_dimensions[i] = row_max_dimensions;
+                    }
+                }
+            });
+        }
+        threads.run();
+    }
+
+    //concatenation of chunks into preallocated buffers
+    rows_t rows;
+    std::size_t rows_count = 0, features_count = 0;
+    for (auto i : irange(threads_count)) {
+        rows_count += chunks[i].size();
+        features_count += chunks[i].feature_ids.size();
+        assign_max(max_dimensions, chunks_max_dimensions[i]);
+    }
+    rows.row_starts.resize(rows_count + 1);
+    rows.results.resize(rows_count);
+    rows.feature_ids.resize(features_count);
+    rows.values.resize(features_count);
+
+    thread_pool threads(threads_count);
+    std::size_t row_offset = 0, feature_offset = 0;
+    for (auto &chunk : chunks) {
+        threads.post([&, row_offset, feature_offset]() {
+            std::copy(chunk.results.begin(), chunk.results.end(), rows.results.begin() + row_offset);
+            std::copy(chunk.feature_ids.begin(), chunk.feature_ids.end(), rows.feature_ids.begin() + feature_offset);
+            std::copy(chunk.values.begin(), chunk.values.end(), rows.values.begin() + feature_offset);
+            for (auto i : irange(chunk.size())) {
+                rows.row_starts[row_offset + i + 1] = feature_offset + chunk.row_starts[i + 1];
+            }
+        });
+        row_offset += chunk.size();
+        feature_offset += chunk.feature_ids.size();
+    }
+    threads.run();
+
+    return rows;
+}
+
+/**
+ * @brief Reads svm file using memory mapping, see read_svm_parallel for the data in memory.
+ *
+ * @param file_path
+ * @param dimensions
+ * @param max_dimensions updated with maximal feature id + 1 of the returned rows
+ * @param should_ignore_bad_row functor (std::string const & line, std::size_t offset) -> bool,
+ *        offset is the offset of the bad line from the beginning of the file
+ * @param threads_count has to be positive, std::invalid_argument is thrown otherwise
+ *
+ * @return svm_csr_rows
+ */
+template <typename ValueType = double,
+          typename ResultType = int,
+          typename FeatureIdType = std::size_t,
+          typename ShouldIgnoreBadRow = utils::always_false>
+auto read_svm_parallel(std::string const &file_path,
+                       std::size_t dimensions,
+                       std::size_t &max_dimensions,
+                       ShouldIgnoreBadRow &&should_ignore_bad_row = ShouldIgnoreBadRow{},
+                       unsigned threads_count = detail::default_svm_threads_count()) {
+    if (threads_count == 0) {
+        throw std::invalid_argument("read_svm_parallel needs at least one thread");
+    }
+    //empty file cannot be mapped
+    if (std::ifstream(file_path, std::ios::binary | std::ios::ate).tellg() <= 0) {
+        return svm_csr_rows<ValueType, ResultType, FeatureIdType>{};
+    }
+    boost::iostreams::mapped_file_source mapped(file_path);
+    return read_svm_parallel<ValueType, ResultType, FeatureIdType>(
+                mapped.data(), mapped.size(), dimensions, max_dimensions,
+                std::forward<ShouldIgnoreBadRow>(should_ignore_bad_row), threads_count);
+}
+
+} //! paal
+
+#endif // PAAL_READ_SVM_PARALLEL_HPP
@@ -115,6 +115,16 @@ BOOST_AUTO_TEST_CASE(final_compress) {
     BOOST_CHECK(boost::equal(row_buffer, std::vector<std::vector<coordinate_t>>{{0, 1, 2}, {2, 3, 4}}));
 }
 
+BOOST_AUTO_TEST_CASE(compress_method) {
+    std::string input = create_tmp_file("input_cm", "0 1 2\n2 3 4\n1 1 1\n5 0 5\n7 1 0");
+    std::string output = get_temp_file_path("output_cm");
+
+    call(fd_bin + " -i " + input + " -o " + output + " -r 4 --compress_method gram");
+    read_sketch_check_size(output, 2, 3);
+
+    call_fail(fd_bin + " -i " + input + " -o " + output + " -r 4 --compress_method qr");
+}
+
 BOOST_AUTO_TEST_CASE(row_buffer_size) {
     std::string input = create_tmp_file("input_rbs", "0 1 2\n2 3 4");
     std::string output = get_temp_file_path("output_rbs");
@@ -142,6 +152,37 @@ BOOST_AUTO_TEST_CASE(model) {
     read_sketch_check_size(output, 2, 3);
 }
 
+BOOST_AUTO_TEST_CASE(nthread) {
+    std::ostringstream data;
+    for (auto row_id : paal::irange(500)) {
+        data << row_id << " " << (row_id % 7) << " " << (row_id % 5) << "\n";
+    }
+    std::string input = create_tmp_file("input_n", data.str());
+    std::string output = get_temp_file_path("output_n");
+
+    call(fd_bin + " -i " + input + " -o " + output + " -r 4 -n 3");
+    read_sketch_check_size(output, 2, 3);
+
+    call_fail(fd_bin + " -i " + input + " -o " + output + " -r 4 -n 0");
+}
+
+BOOST_AUTO_TEST_CASE(merge_model) {
+    std::string input = create_tmp_file("input_mm", "0 1 2\n2 3 4");
+    std::string input_other = create_tmp_file("input_mm_other", "1 0 0\n0 0 5");
+    std::string output = get_temp_file_path("output_mm");
+    std::string model = get_temp_file_path("model_mm");
+    std::string model_other = get_temp_file_path("model_mm_other");
+
+    call(fd_bin + " --model_out " + model + " -i " + input + " -o " + output + " -r 4 --final_compress 0");
+    call(fd_bin + " --model_out " + model_other + " -i " + input_other + " -o " + output + " -r 4 --final_compress 0");
+    call(fd_bin + " --model_in " + model + " --merge_model " + model_other +
+         " -i " + input + " -o " + output + " --final_compress 0");
+
+    // rows of the model and the input fill the sketch, it is compressed to 2 rows
+    // before 2 rows of the merged model are added
+    read_sketch_check_size(output, 4, 3);
+}
+
 BOOST_AUTO_TEST_CASE(multi_read) {
     std::ostringstream data;
     for (auto row_id : paal::irange(500)) {
@@ -137,4 +137,19 @@ BOOST_AUTO_TEST_CASE(lsh_bin_serialization) {
     test_files_are_equal(res, expect2);
 }
 
+BOOST_AUTO_TEST_CASE(lsh_bin_stream_training) {
+    std::string example = create_tmp_file("stream_example", "1 0:1\n0 0:1\n0 0:1\n0 0:1");
+    std::string test = create_tmp_file("stream_test", "0 0:3");
+    std::string model(get_temp_file_path("stream_model")),
+                res(get_temp_file_path("stream_res.txt"));
+
+    call("cat " + example + " | " + lsh_bin + " -d - --model_out " + model +
+            " --dimensions=1 --row_buffer_size=3 --checkpoint_rows=2");
+    call(lsh_bin + " --model_in " + model + " -o " + res + " -t " + test);
+    std::string expect = create_tmp_file("stream_expect", "0.25");
+    test_files_are_equal(res, expect);
+
+    call_fail(lsh_bin + " -d " + example + " --dimensions=1 --checkpoint_rows=2");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -54,4 +54,15 @@ template <template <class> class Cycle> void swap_edges_4() {
     Cycle<std::string> sc(v.begin(), v.begin() + 4);
     check_swap(sc, "2", "3", "1", sol);
 }
+template <template <class> class Cycle> void next_prev() {
+    Cycle<std::string> sc(v.begin(), v.begin() + 5);
+    sc.flip("2", "4");
+    std::vector<std::string> sol = { "1", "4", "3", "2", "5" };
+    for (std::size_t i = 0; i < sol.size(); ++i) {
+        auto const &next = sol[(i + 1) % sol.size()];
+        auto const &prev = sol[(i + sol.size() - 1) % sol.size()];
+        BOOST_CHECK_EQUAL(sc.next(sol[i]), next);
+        BOOST_CHECK_EQUAL(sc.prev(sol[i]), prev);
+    }
+}
 #endif // PAAL_CYCLE_HPP
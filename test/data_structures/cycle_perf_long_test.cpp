@@ -0,0 +1,88 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file cycle_perf_long_test.cpp
+ * @brief compares simple_cycle, splay_cycle and two_level_cycle
+ * on the 2-opt/Or-opt search of TSPLIB tours,
+ * times are printed with --log_level=message
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "test_utils/read_tsplib.hpp"
+#include "test_utils/get_test_dir.hpp"
+
+#include "paal/data_structures/cycle/cycle_algo.hpp"
+#include "paal/data_structures/cycle/simple_cycle.hpp"
+#include "paal/data_structures/cycle/splay_cycle.hpp"
+#include "paal/data_structures/cycle/two_level_cycle.hpp"
+#include "paal/local_search/2_local_search/2_local_search.hpp"
+
+#include <boost/range/algorithm/equal.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace paal;
+
+namespace {
+
+// instances with more vertices are skipped, simple_cycle is too slow for them
+const std::size_t max_size = 20000;
+
+template <typename Cycle>
+std::vector<int> search(const read_tsplib::TSPLIB_Matrix &mtx,
+                        const std::vector<int> &start, const std::string &name) {
+    Cycle cycle(start.begin(), start.end());
+    auto lsc = local_search::make_two_local_search_neighbor_components(mtx, start, 8);
+    auto begin = std::chrono::steady_clock::now();
+    local_search::two_local_search(cycle, local_search::first_improving_strategy{},
+                                   utils::always_true{}, utils::always_false{}, lsc);
+    auto end = std::chrono::steady_clock::now();
+    BOOST_TEST_MESSAGE("    " << name << ": "
+                       << std::chrono::duration<double>(end - begin).count()
+                       << "s, length " << get_cycle_length(mtx, cycle));
+    return std::vector<int>(cycle.vbegin(start.front()), cycle.vend());
+}
+
+void compare_cycles(const std::string &dir_path, const std::string &index) {
+    read_tsplib::TSPLIB_Directory dir(dir_path, index);
+    read_tsplib::TSPLIB_Matrix mtx;
+    std::string fname;
+    float opt;
+    std::default_random_engine engine;
+    while (dir.get_graph(fname, opt)) {
+        std::ifstream is(fname);
+        read_tsplib::TSPLIB_Directory::Graph g(is);
+        g.load(mtx);
+        auto size = mtx.size();
+        if (size < 1000 || size > max_size) continue;
+        std::vector<int> start(size);
+        std::iota(start.begin(), start.end(), 0);
+        std::shuffle(start.begin(), start.end(), engine);
+
+        BOOST_TEST_MESSAGE(fname << " (" << size << " vertices)");
+        auto simple = search<data_structures::simple_cycle<int>>(mtx, start, "simple_cycle");
+        auto splay = search<data_structures::splay_cycle<int>>(mtx, start, "splay_cycle");
+        auto two_level = search<data_structures::two_level_cycle<int>>(mtx, start, "two_level_cycle");
+        // all cycles perform exactly the same moves
+        BOOST_CHECK(simple == splay);
+        BOOST_CHECK(simple == two_level);
+    }
+}
+
+} //!anonymous
+
+BOOST_AUTO_TEST_CASE(cycle_perf_TSPLIB) {
+    compare_cycles(system::get_test_data_dir("TSPLIB/symmetrical"), "index");
+    compare_cycles(system::get_test_data_dir("TSPLIB/symmetrical/long"), "index.long");
+}
@@ -0,0 +1,131 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+#include "test_utils/sample_graph.hpp"
+
+#include "paal/data_structures/metric/basic_metrics.hpp"
+#include "paal/data_structures/voronoi/dense_voronoi.hpp"
+#include "paal/data_structures/voronoi/voronoi.hpp"
+#include "paal/local_search/facility_location/facility_location.hpp"
+#include "paal/utils/functors.hpp"
+
+#include <boost/range/algorithm/min_element.hpp>
+#include <boost/range/algorithm/sort.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+
+using namespace paal::data_structures;
+
+namespace {
+template <typename Range> std::vector<int> sorted(Range && r) {
+    std::vector<int> v(std::begin(r), std::end(r));
+    boost::sort(v);
+    return v;
+}
+} //!anonymous
+
+BOOST_AUTO_TEST_CASE(dense_voronoi_rem_add) {
+    typedef sample_graphs_metrics SGM;
+    auto gm = SGM::get_graph_metric_small();
+
+    typedef dense_voronoi<decltype(gm)> voronoi_t;
+    typedef voronoi_traits<voronoi_t> VT;
+    typedef VT::GeneratorsSet GSet;
+    typedef VT::VerticesSet VSet;
+    voronoi_t vor(GSet{}, VSet{ SGM::A, SGM::B, SGM::C, SGM::D, SGM::E }, gm);
+
+    vor.add_generator(SGM::A);
+    auto ab_min_a = vor.add_generator(SGM::B);
+    auto b_min_ab = vor.rem_generator(SGM::A);
+    BOOST_CHECK_EQUAL(vor.add_generator(SGM::A), -b_min_ab);
+    BOOST_CHECK_EQUAL(vor.rem_generator(SGM::B), -ab_min_a);
+    BOOST_CHECK(sorted(vor.get_vertices_for_generator(SGM::A)) ==
+                sorted(vor.get_vertices()));
+    BOOST_CHECK(boost::empty(vor.get_vertices_for_generator(SGM::B)));
+
+    BOOST_CHECK(vor == make_dense_voronoi(GSet{ SGM::A }, VSet{ SGM::A, SGM::B, SGM::C, SGM::D, SGM::E }, gm));
+}
+
+BOOST_AUTO_TEST_CASE(dense_voronoi_compare_with_voronoi) {
+    const int n = 40;
+    std::default_random_engine engine;
+    std::uniform_int_distribution<int> distance(1, 100);
+    array_metric<int> am(n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            am(i, j) = i == j ? 0 : distance(engine);
+        }
+    }
+
+    typedef voronoi<array_metric<int>> voronoi_t;
+    typedef dense_voronoi<array_metric<int>> dense_voronoi_t;
+    voronoi_t::Vertices vertices;
+    dense_voronoi_t::Vertices dense_vertices;
+    for (int i = 0; i < n; i += 2) {
+        vertices.insert(i);
+        dense_vertices.push_back(i);
+    }
+    voronoi_t vor({}, vertices, am, 1000);
+    dense_voronoi_t dense_vor({}, dense_vertices, am, 1000);
+
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    for (int step = 0; step < 500; ++step) {
+        int g = vertex(engine);
+        if (vor.get_generators().count(g)) {
+            BOOST_CHECK_EQUAL(vor.rem_generator(g), dense_vor.rem_generator(g));
+        } else {
+            BOOST_CHECK_EQUAL(vor.add_generator(g), dense_vor.add_generator(g));
+        }
+        BOOST_CHECK(sorted(vor.get_generators()) == sorted(dense_vor.get_generators()));
+        for (int v = 0; v < n; ++v) {
+            BOOST_CHECK_EQUAL(vor.get_generators().count(v) == 1, dense_vor.is_generator(v));
+        }
+
+        // the assignment of vertices with ties may differ, the distances may not
+        for (auto f : vor.get_generators()) {
+            for (auto v : dense_vor.get_vertices_for_generator(f)) {
+                auto f_min = *boost::min_element(vor.get_generators(), [&](int a, int b){
+                        return am(v, a) < am(v, b);});
+                BOOST_CHECK_EQUAL(am(v, f), am(v, f_min));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dense_voronoi_facility_location) {
+    typedef sample_graphs_metrics SGM;
+    auto g = SGM::get_graph_medium();
+    SGM::GraphMT gm(g);
+    std::vector<int> fcosts{ 7, 8, 30, 2, 11, 40, 5, 9, 13 };
+    auto cost = paal::utils::make_array_to_functor(fcosts);
+
+    typedef voronoi<decltype(gm)> voronoi_t;
+    typedef dense_voronoi<decltype(gm)> dense_voronoi_t;
+    typedef facility_location_solution<decltype(cost), voronoi_t> Sol;
+    typedef facility_location_solution<decltype(cost), dense_voronoi_t> DenseSol;
+    typedef voronoi_t::GeneratorsSet FSet;
+    FSet all{ SGM::A, SGM::B, SGM::C, SGM::D, SGM::E, SGM::F, SGM::G, SGM::H, SGM::I };
+    FSet chosen{ SGM::A, SGM::E, SGM::I };
+    FSet unchosen{ SGM::B, SGM::C, SGM::D, SGM::F, SGM::G, SGM::H };
+
+    Sol sol(voronoi_t(chosen, all, gm), unchosen, cost);
+    DenseSol dense_sol(dense_voronoi_t(chosen, dense_voronoi_t::Vertices(all.begin(), all.end()), gm),
+                       unchosen, cost);
+
+    using namespace paal::local_search;
+    facility_location_local_search(sol, best_improving_strategy{},
+            paal::utils::always_true{}, paal::utils::always_false{},
+            default_remove_fl_components{}, default_add_fl_components{},
+            read_only_swap_fl_components{});
+    facility_location_local_search(dense_sol, best_improving_strategy{},
+            paal::utils::always_true{}, paal::utils::always_false{},
+            default_remove_fl_components{}, default_add_fl_components{},
+            read_only_swap_fl_components{});
+    BOOST_CHECK(sorted(sol.get_chosen_facilities()) ==
+                sorted(dense_sol.get_chosen_facilities()));
+}
@@ -24,7 +24,10 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
 #include <cmath>
+#include <thread>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(euclidean_metric_test) {
     auto metric=paal::data_structures::euclidean_metric<int>();
@@ -41,6 +44,71 @@ BOOST_AUTO_TEST_CASE(metric_test) {
     BOOST_CHECK_EQUAL(gm(SGM::C, SGM::B) , 3);
 }
 
+BOOST_AUTO_TEST_CASE(parallel_graph_metric_test) {
+    using SGM = sample_graphs_metrics;
+    using parallel_metric = paal::data_structures::graph_metric<
+        SGM::Graph, int, paal::data_structures::graph_type::parallel_tag>;
+    using filler = paal::data_structures::graph_metric_filler_impl<
+        paal::data_structures::graph_type::parallel_tag>;
+
+    for (auto g : {SGM::get_graph_small(), SGM::get_graph_medium(),
+                   SGM::get_star_random(7, 100, 1, 20)}) {
+        SGM::GraphMT expected(g);
+        for (unsigned threads_count : {1, 3}) {
+            parallel_metric gm(g, filler(threads_count));
+            BOOST_CHECK(static_cast<paal::data_structures::array_metric<int> const &>(gm) ==
+                        static_cast<paal::data_structures::array_metric<int> const &>(expected));
+        }
+    }
+
+    // vertex which is not connected
+    SGM::Graph g(3);
+    add_edge(0, 1, 5, g);
+    parallel_metric gm(g);
+    BOOST_CHECK_EQUAL(gm(1, 0), 5);
+    BOOST_CHECK_EQUAL(gm(2, 2), 0);
+    BOOST_CHECK_EQUAL(gm(0, 2), SGM::GraphMT(g)(0, 2));
+}
+
+BOOST_AUTO_TEST_CASE(large_graph_metric_test) {
+    using SGM = sample_graphs_metrics;
+    using large_metric = paal::data_structures::graph_metric<
+        SGM::Graph, int, paal::data_structures::graph_type::large_tag>;
+
+    auto g = SGM::get_star_random(13, 50, 1, 20);
+    SGM::GraphMT expected(g);
+    auto const vertices_count = num_vertices(g);
+
+    // room for two rows only
+    large_metric gm(g, 2 * vertices_count * sizeof(int));
+    BOOST_CHECK_EQUAL(gm.max_cached_rows(), 2);
+    for (auto v : paal::irange(vertices_count)) {
+        for (auto w : paal::irange(vertices_count)) {
+            BOOST_CHECK_EQUAL(gm(v, w), expected(v, w));
+        }
+    }
+    BOOST_CHECK_EQUAL(gm.cached_rows(), 2);
+
+    auto copy = gm;
+    BOOST_CHECK(copy == gm);
+    BOOST_CHECK(!(large_metric(g) == gm));
+
+    // concurrent readers
+    std::vector<std::thread> threads;
+    std::atomic<int> errors{0};
+    for (auto t : paal::irange(4)) {
+        threads.emplace_back([&, t]() {
+            for (auto i : paal::irange(500)) {
+                auto v = (i * 7 + t) % vertices_count;
+                auto w = (i * 13 + 3 * t) % vertices_count;
+                if (gm(v, w) != expected(v, w)) ++errors;
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    BOOST_CHECK_EQUAL(errors, 0);
+}
+
 BOOST_AUTO_TEST_CASE(copyrectangle_array_metric) {
     paal::data_structures::rectangle_array_metric<int> m(1, 2);
     m(0, 0) = 1;
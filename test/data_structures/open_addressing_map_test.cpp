@@ -0,0 +1,136 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file open_addressing_map_test.cpp
+ * @brief
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "test_utils/serialization.hpp"
+
+#include "paal/data_structures/open_addressing_map.hpp"
+#include "paal/utils/irange.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+using map_t = paal::data_structures::open_addressing_map<int>;
+}
+
+BOOST_AUTO_TEST_SUITE(open_addressing_map)
+
+BOOST_AUTO_TEST_CASE(insert_and_find) {
+    map_t map;
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK(map.find(5) == nullptr);
+
+    for (auto i : paal::irange(1, 1000)) {
+        map[i * 7919] += i;
+    }
+    map[7919] += 1;
+
+    BOOST_CHECK_EQUAL(map.size(), 999);
+    BOOST_CHECK(4 * map.size() <= 3 * map.capacity());
+    BOOST_CHECK_EQUAL(*map.find(7919), 2);
+    for (auto i : paal::irange(2, 1000)) {
+        BOOST_CHECK_EQUAL(*map.find(i * 7919), i);
+    }
+    BOOST_CHECK(map.find(7918) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(all_keys_can_be_inserted) {
+    map_t map;
+    map[0] = 10;
+    map[1] = 11;
+    map[~std::uint64_t(0)] = 12;
+    BOOST_CHECK_EQUAL(map.size(), 3);
+    BOOST_CHECK_EQUAL(*map.find(0), 10);
+    BOOST_CHECK_EQUAL(*map.find(1), 11);
+    BOOST_CHECK_EQUAL(*map.find(~std::uint64_t(0)), 12);
+    BOOST_CHECK(map.find(2) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(values_with_equal_keys) {
+    map_t map;
+    for (auto i : paal::irange(100)) {
+        auto same_value = [i](int value) { return value == i; };
+        auto inserted = map.insert(i % 3, same_value);
+        BOOST_CHECK(inserted.second);
+        *inserted.first = i;
+        BOOST_CHECK(!map.insert(i % 3, same_value).second);
+    }
+    BOOST_CHECK_EQUAL(map.size(), 100);
+    for (auto i : paal::irange(100)) {
+        auto found = map.find(i % 3, [i](int value) { return value == i; });
+        BOOST_REQUIRE(found != nullptr);
+        BOOST_CHECK_EQUAL(*found, i);
+        BOOST_CHECK(map.find((i + 1) % 3, [i](int value) { return value == i; }) == nullptr);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(equality_does_not_depend_on_insertion_order) {
+    map_t map1, map2;
+    map2.reserve(100);
+    for (auto i : paal::irange(1, 50)) {
+        map1[i] = i;
+        map2[50 - i] = 50 - i;
+    }
+    BOOST_CHECK(map1 == map2);
+    map2[1] = 0;
+    BOOST_CHECK(!(map1 == map2));
+}
+
+BOOST_AUTO_TEST_CASE(view) {
+    map_t map;
+    for (auto i : paal::irange(1, 100)) {
+        map[i] = 2 * i;
+    }
+    auto slots = std::make_shared<std::vector<map_t::slot>>(map.slots());
+    paal::data_structures::open_addressing_map_view<int> view(
+            slots->data(), slots->size(), map.size(), slots);
+    slots.reset();
+
+    BOOST_CHECK_EQUAL(view.size(), map.size());
+    for (auto i : paal::irange(1, 100)) {
+        BOOST_CHECK_EQUAL(*view.find(i), 2 * i);
+    }
+    BOOST_CHECK(view.find(100) == nullptr);
+    BOOST_CHECK(paal::data_structures::open_addressing_map_view<int>{}.find(1) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(view_of_corrupted_slots) {
+    // all the slots occupied, flags other than 1, as in a corrupted file
+    std::vector<map_t::slot> slots(16);
+    for (auto i : paal::irange(slots.size())) {
+        slots[i].key = 1000 + i;
+        slots[i].value = i;
+        slots[i].occupied = 2 + i * 15;
+    }
+    paal::data_structures::open_addressing_map_view<int> view(
+            slots.data(), slots.size(), slots.size(), nullptr);
+    BOOST_CHECK(view.find(1) == nullptr);
+    BOOST_REQUIRE(view.find(1005) != nullptr);
+    BOOST_CHECK_EQUAL(*view.find(1005), 5);
+}
+
+BOOST_AUTO_TEST_CASE(serialization) {
+    map_t map;
+    for (auto i : paal::irange(1, 100)) {
+        map[std::uint64_t(i) << 40] = i;
+    }
+    serialize_test(map, "open_addressing_map.bin");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -96,4 +96,8 @@ BOOST_AUTO_TEST_CASE(swap_edges_4_test) {
 
     swap_edges_4<simpl_cycle_temp>();
 }
+
+BOOST_AUTO_TEST_CASE(next_prev_test) {
+    next_prev<simpl_cycle_temp>();
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -66,3 +66,7 @@ BOOST_AUTO_TEST_CASE(swap_edges_3_1_test) {
 BOOST_AUTO_TEST_CASE(swap_edges_4_test) {
     swap_edges_4<paal::data_structures::splay_cycle>();
 }
+
+BOOST_AUTO_TEST_CASE(next_prev_test) {
+    next_prev<paal::data_structures::splay_cycle>();
+}
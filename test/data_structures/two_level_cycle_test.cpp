@@ -0,0 +1,87 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file two_level_cycle_test.cpp
+ * @brief
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "cycle.hpp"
+
+#include "paal/data_structures/cycle/two_level_cycle.hpp"
+#include "paal/data_structures/cycle/simple_cycle.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/range/algorithm/equal.hpp>
+
+#include <numeric>
+#include <random>
+
+using paal::data_structures::two_level_cycle;
+
+BOOST_AUTO_TEST_CASE(two_level_cycle_test) {
+    std::vector<int> v{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    two_level_cycle<int> tc(v.begin(), v.end());
+    auto construct_range = [&]() {
+        return boost::make_iterator_range(tc.vbegin(1), tc.vend());
+    };
+    BOOST_CHECK(boost::equal(construct_range(), v));
+
+    tc.flip(3, 5);
+    std::vector<int> v2{ 1, 2, 5, 4, 3, 6, 7, 8, 9, 10 };
+    BOOST_CHECK(boost::equal(construct_range(), v2));
+
+    // the path from 8 to 2 goes through the end of the sequence
+    tc.flip(8, 2);
+    std::vector<int> v3{ 1, 10, 9, 8, 5, 4, 3, 6, 7, 2 };
+    BOOST_CHECK(boost::equal(construct_range(), v3));
+}
+
+BOOST_AUTO_TEST_CASE(two_level_cycle_swap_edges_3_test) {
+    swap_edges_3<two_level_cycle>();
+}
+
+BOOST_AUTO_TEST_CASE(two_level_cycle_swap_edges_3_1_test) {
+    swap_edges_3_1<two_level_cycle>();
+}
+
+BOOST_AUTO_TEST_CASE(two_level_cycle_swap_edges_4_test) {
+    swap_edges_4<two_level_cycle>();
+}
+
+BOOST_AUTO_TEST_CASE(two_level_cycle_next_prev_test) {
+    next_prev<two_level_cycle>();
+}
+
+BOOST_AUTO_TEST_CASE(two_level_cycle_random_flips_test) {
+    const int size = 500;
+    std::vector<int> v(size);
+    std::iota(v.begin(), v.end(), 0);
+    std::default_random_engine engine;
+    std::shuffle(v.begin(), v.end(), engine);
+    paal::data_structures::simple_cycle<int> sc(v.begin(), v.end());
+    two_level_cycle<int> tc(v.begin(), v.end());
+
+    std::uniform_int_distribution<int> vertex(0, size - 1);
+    for (int i = 0; i < 2000; ++i) {
+        int b = vertex(engine);
+        int e = vertex(engine);
+        // flip of the whole cycle is not supported by simple_cycle
+        if (sc.prev(b) == e) continue;
+        sc.flip(b, e);
+        tc.flip(b, e);
+        BOOST_REQUIRE(boost::equal(boost::make_iterator_range(sc.vbegin(0), sc.vend()),
+                                   boost::make_iterator_range(tc.vbegin(0), tc.vend())));
+        BOOST_CHECK_EQUAL(sc.prev(b), tc.prev(b));
+        BOOST_CHECK_EQUAL(sc.next(e), tc.next(e));
+    }
+    // small segments are merged
+    BOOST_CHECK(tc.segments_count() <= 2 * size / 22 + 1);
+}
@@ -88,3 +88,20 @@ BOOST_AUTO_TEST_CASE(test_make_voronoi) {
 
     BOOST_CHECK(vor == make_voronoi(GSet{ SGM::A, SGM::B }, VSet{ SGM::A, SGM::B, SGM::C, SGM::D, SGM::E }, gm));
 }
+
+BOOST_AUTO_TEST_CASE(large_graph_metric_voronoi) {
+    typedef sample_graphs_metrics SGM;
+    auto g = SGM::get_graph_small();
+    auto gm = SGM::GraphMT(g);
+    graph_metric<SGM::Graph, int, graph_type::large_tag> lgm(g, sizeof(int));
+
+    typedef voronoi<decltype(gm)> voronoi_t;
+    typedef voronoi<decltype(lgm)> large_voronoi_t;
+    typedef voronoi_t::GeneratorsSet FSet;
+    voronoi_t vor(FSet{}, FSet{ SGM::A, SGM::B, SGM::C, SGM::D, SGM::E }, gm);
+    large_voronoi_t large_vor(FSet{}, FSet{ SGM::A, SGM::B, SGM::C, SGM::D, SGM::E }, lgm);
+
+    BOOST_CHECK_EQUAL(vor.add_generator(SGM::A), large_vor.add_generator(SGM::A));
+    BOOST_CHECK_EQUAL(vor.add_generator(SGM::D), large_vor.add_generator(SGM::D));
+    BOOST_CHECK_EQUAL(vor.rem_generator(SGM::A), large_vor.rem_generator(SGM::A));
+}
@@ -153,6 +153,10 @@ BOOST_AUTO_TEST_CASE(bounded_degree_mst_long) {
             LOGLN("most violated");
             run_test<paal::lp::max_violated_separation_oracle>(
                             g, costs, bounds, vertices_num, best_cost);
+
+            LOGLN("most violated, parallel");
+            run_test<paal::lp::parallel_max_violated_separation_oracle>(
+                            g, costs, bounds, vertices_num, best_cost);
         }
 
         // non-default heuristics
@@ -160,6 +164,10 @@ BOOST_AUTO_TEST_CASE(bounded_degree_mst_long) {
             LOGLN("first violated");
             run_test<paal::lp::first_violated_separation_oracle>(
                             g, costs, bounds, vertices_num, best_cost);
+
+            LOGLN("first violated, parallel");
+            run_test<paal::lp::parallel_first_violated_separation_oracle>(
+                            g, costs, bounds, vertices_num, best_cost);
         }
     });
 }
@@ -128,6 +128,27 @@ BOOST_AUTO_TEST_CASE(bounded_degree_mst_test_parameters) {
         BOOST_CHECK_EQUAL(correct_bdmst.size(),result_tree.size());
         BOOST_CHECK(std::equal(correct_bdmst.begin(), correct_bdmst.end(), result_tree.begin()));
     }
+    {
+        ResultTree result_tree;
+        std::vector<ir_iteration_statistics> statistics;
+        auto bdmst(make_bounded_degree_mst(g, bounds, boost::weight_map(cost),
+                    std::inserter(result_tree, result_tree.begin())));
+        solve_iterative_rounding(bdmst, bdmst_ir_components<>{},
+                                 statistics_visitor(statistics));
+
+        BOOST_CHECK(std::equal(correct_bdmst.begin(), correct_bdmst.end(), result_tree.begin()));
+        BOOST_REQUIRE(!statistics.empty());
+        BOOST_CHECK_EQUAL(statistics.front().lp.warm_starts, 0);
+        BOOST_CHECK_EQUAL(statistics.front().rounded + statistics.front().relaxed, 0);
+        for (auto const & s : statistics) {
+            BOOST_CHECK(s.lp.solves > 0);
+            BOOST_CHECK(s.lp.iterations >= 0);
+            BOOST_CHECK(s.lp.seconds >= 0);
+        }
+        for (auto const & s : boost::make_iterator_range(statistics.begin() + 1, statistics.end())) {
+            BOOST_CHECK(s.rounded + s.relaxed > 0);
+        }
+    }
 }
 
 BOOST_AUTO_TEST_CASE(bounded_degree_mst_list) {
@@ -0,0 +1,89 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file generalised_assignment_parallel_test.cpp
+ * @brief
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "paal/data_structures/metric/basic_metrics.hpp"
+#include "paal/data_structures/thread_pool.hpp"
+#include "paal/iterative_rounding/generalised_assignment/generalised_assignment.hpp"
+#include "paal/lp/dual_simplex.hpp"
+#include "paal/utils/irange.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <vector>
+
+using namespace paal;
+
+namespace {
+
+using assignment = std::map<int, int>;
+
+// generalised assignment instance with 4 machines and 12 jobs
+struct ga_instance {
+    ga_instance() : cost(12), time(12) {
+        for (auto j : irange(12)) {
+            for (auto m : irange(4)) {
+                cost(j, m) = (j * 7 + m * 13) % 10 + 1;
+                time(j, m) = (j * 3 + m * 5) % 4 + 1;
+            }
+        }
+    }
+
+    ir::IRResult solve(assignment &jobs_to_machines) const {
+        auto machines = irange(4);
+        auto jobs = irange(12);
+        auto T = [](int) { return 9; };
+        auto ga = ir::make_generalised_assignment(
+            machines.begin(), machines.end(), jobs.begin(), jobs.end(), cost,
+            time, T, std::inserter(jobs_to_machines, jobs_to_machines.begin()));
+        return ir::solve_iterative_rounding<decltype(ga), ir::ga_ir_components<>,
+                                            ir::trivial_visitor,
+                                            lp::dual_simplex>(
+            ga, ir::ga_ir_components<>{});
+    }
+
+    data_structures::array_metric<int> cost;
+    data_structures::array_metric<int> time;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(generalised_assignment_parallel)
+
+BOOST_AUTO_TEST_CASE(generalised_assignment_dual_simplex_threads) {
+    const ga_instance instance;
+    assignment serial;
+    auto serial_result = instance.solve(serial);
+    BOOST_REQUIRE_EQUAL(serial_result.first, lp::OPTIMAL);
+    BOOST_CHECK_EQUAL(serial.size(), 12);
+
+    // each task uses its own LP instance
+    const int tasks = 8;
+    std::vector<assignment> results(tasks);
+    std::vector<ir::IRResult> statuses(tasks);
+    thread_pool threads(4);
+    for (auto i : irange(tasks)) {
+        threads.post([&, i]() { statuses[i] = instance.solve(results[i]); });
+    }
+    threads.run();
+
+    for (auto i : irange(tasks)) {
+        BOOST_CHECK_EQUAL(statuses[i].first, lp::OPTIMAL);
+        BOOST_CHECK_CLOSE(*statuses[i].second, *serial_result.second, 1e-9);
+        BOOST_CHECK(results[i] == serial);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,56 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file gomory_hu_tree_test.cpp
+ * @brief
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "paal/iterative_rounding/gomory_hu_tree.hpp"
+#include "paal/utils/irange.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+
+using namespace paal;
+
+BOOST_AUTO_TEST_SUITE(gomory_hu_tree)
+
+BOOST_AUTO_TEST_CASE(gomory_hu_tree_random_graphs) {
+    std::default_random_engine engine;
+    std::uniform_real_distribution<double> capacity(0, 1);
+    const int n = 12;
+
+    for (int test : irange(10)) {
+        ir::min_cut_finder min_cut;
+        min_cut.init(n);
+        std::bernoulli_distribution has_edge(0.1 + 0.05 * test);
+        for (int u : irange(n)) {
+            for (int v : irange(u + 1, n)) {
+                if (has_edge(engine)) {
+                    auto cap = capacity(engine);
+                    min_cut.add_edge_to_graph(u, v, cap, cap);
+                }
+            }
+        }
+
+        ir::gomory_hu_tree tree;
+        tree.build(min_cut, n);
+        for (int u : irange(n)) {
+            for (int v : irange(u + 1, n)) {
+                BOOST_CHECK_CLOSE(tree.min_cut_value(u, v) + 1,
+                                  min_cut.find_min_cut(u, v) + 1, 1e-6);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
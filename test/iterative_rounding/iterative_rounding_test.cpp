@@ -0,0 +1,145 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file iterative_rounding_test.cpp
+ * @brief
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "paal/iterative_rounding/iterative_rounding.hpp"
+#include "paal/lp/dual_simplex.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace paal;
+
+namespace {
+
+// maximize x + y + z / 2, s.t. x + y + 2z <= 3, 0 <= x, y, z <= 1
+struct shared_row_problem {
+    lp::row_id row;
+    std::vector<double> seen_bounds;
+};
+
+struct shared_row_init {
+    template <typename LP> void operator()(shared_row_problem &problem, LP &lp) {
+        lp.set_optimization_type(lp::MAXIMIZE);
+        auto x = lp.add_column(1, 0, 1);
+        auto y = lp.add_column(1, 0, 1);
+        auto z = lp.add_column(0.5, 0, 1);
+        problem.row = lp.add_row(x + y + 2 * z <= 3);
+    }
+};
+
+// records the bound of the shared row seen by the round condition
+struct recording_round_condition {
+    template <typename LP>
+    boost::optional<double> operator()(shared_row_problem &problem,
+                                       const LP &lp, lp::col_id col) {
+        problem.seen_bounds.push_back(lp.get_row_upper_bound(problem.row));
+        return m_round(problem, lp, col);
+    }
+
+    ir::default_round_condition m_round;
+};
+
+// records the bound of the shared row seen by the visitor
+struct recording_visitor : ir::trivial_visitor {
+    template <typename LP>
+    void round_col(shared_row_problem &problem, LP &lp, lp::col_id, double) {
+        problem.seen_bounds.push_back(lp.get_row_upper_bound(problem.row));
+    }
+};
+
+// LP without solve statistics
+struct lp_without_statistics : lp::dual_simplex {
+    void get_solve_statistics() const = delete;
+};
+
+// visitor without solve_lp_statistics
+struct counting_visitor {
+    template <typename Problem, typename LP> void solve_lp(Problem &, LP &) {
+        ++*m_solves;
+    }
+
+    template <typename Problem, typename LP>
+    void round_col(Problem &, LP &, lp::col_id, double) {}
+
+    template <typename Problem, typename LP>
+    void relax_row(Problem &, LP &, lp::row_id) {}
+
+    int *m_solves;
+};
+
+template <typename Visitor, typename LP>
+void solve_shared_row_problem(Visitor visitor) {
+    shared_row_problem problem;
+    auto components = ir::make_IRcomponents(shared_row_init{});
+    ir::detail::iterative_rounding<shared_row_problem, decltype(components),
+                                   Visitor, LP> ir(problem, components,
+                                                   visitor);
+    BOOST_REQUIRE_EQUAL(ir.solve_lp(), lp::OPTIMAL);
+    BOOST_CHECK(ir.round());
+    BOOST_REQUIRE_EQUAL(ir.resolve_lp(), lp::OPTIMAL);
+    BOOST_CHECK_CLOSE(ir.get_solution_cost(), 2.25, 1e-9);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(iterative_rounding)
+
+BOOST_AUTO_TEST_CASE(round_columns_sharing_row) {
+    shared_row_problem problem;
+    auto components = ir::make_IRcomponents(shared_row_init{},
+                                            recording_round_condition{});
+    ir::detail::iterative_rounding<shared_row_problem, decltype(components),
+                                   recording_visitor, lp::dual_simplex>
+        ir(problem, components);
+
+    BOOST_REQUIRE_EQUAL(ir.solve_lp(), lp::OPTIMAL);
+    BOOST_CHECK(ir.round());
+
+    // x and y are rounded to 1 in one pass, z stays fractional,
+    // all the conditions and the visitor calls see the original row
+    BOOST_CHECK_EQUAL(ir.get_lp().columns_number(), 1);
+    BOOST_CHECK_EQUAL(problem.seen_bounds.size(), 3 + 2);
+    for (auto bound : problem.seen_bounds) {
+        BOOST_CHECK_CLOSE(bound, 3, 1e-9);
+    }
+    BOOST_CHECK_CLOSE(ir.get_lp().get_row_upper_bound(problem.row), 1, 1e-9);
+
+    BOOST_REQUIRE_EQUAL(ir.resolve_lp(), lp::OPTIMAL);
+    BOOST_CHECK_CLOSE(ir.get_solution_cost(), 2.25, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(solve_lp_statistics_optional) {
+    std::vector<ir::ir_iteration_statistics> iterations;
+    solve_shared_row_problem<ir::statistics_visitor, lp::dual_simplex>(
+        ir::statistics_visitor(iterations));
+    BOOST_REQUIRE_EQUAL(iterations.size(), 2);
+    BOOST_CHECK_EQUAL(iterations[0].lp.solves, 1);
+    BOOST_CHECK_EQUAL(iterations[1].rounded, 2);
+
+    // no statistics from the LP, the visitor is not called
+    iterations.clear();
+    solve_shared_row_problem<ir::statistics_visitor, lp_without_statistics>(
+        ir::statistics_visitor(iterations));
+    BOOST_CHECK(iterations.empty());
+
+    // the visitor does not take the statistics
+    int solves = 0;
+    solve_shared_row_problem<counting_visitor, lp::dual_simplex>(
+        counting_visitor{ &solves });
+    BOOST_CHECK_EQUAL(solves, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
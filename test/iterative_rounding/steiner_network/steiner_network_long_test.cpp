@@ -193,7 +193,8 @@ int generate_instance(Graph & g, RestrictionVec & res, int vertices_num,
     return vertices_num;
 }
 
-template <typename Oracle, typename Restrictions>
+template <typename Oracle, typename Separation = paal::ir::per_pair_separation,
+          typename Restrictions>
 void run_single_test(const Graph &g, const Cost &costs,
                      const Restrictions &restrictions) {
     namespace ir = paal::ir;
@@ -201,7 +202,7 @@ void run_single_test(const Graph &g, const Cost &costs,
 
     using ResultNetwork = std::vector<Edge>;
     ResultNetwork result_network;
-    auto steiner_network(ir::make_steiner_network<Oracle>(g, restrictions,
+    auto steiner_network(ir::make_steiner_network<Oracle, Separation>(g, restrictions,
                             std::back_inserter(result_network)));
     auto invalid = steiner_network.check_input_validity();
     BOOST_CHECK(!invalid);
@@ -227,6 +228,14 @@ void run_test(const Graph & g, const Cost & costs, const Restrictions & restrict
         LOGLN("most violated");
         run_single_test<paal::lp::max_violated_separation_oracle>(
             g, costs, restrictions);
+
+        LOGLN("most violated, parallel");
+        run_single_test<paal::lp::parallel_max_violated_separation_oracle>(
+            g, costs, restrictions);
+
+        LOGLN("most violated, cut tree");
+        run_single_test<paal::lp::max_violated_separation_oracle,
+                        paal::ir::cut_tree_separation>(g, costs, restrictions);
     }
 
     // non-default heuristics
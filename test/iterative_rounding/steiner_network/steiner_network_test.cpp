@@ -69,6 +69,23 @@ BOOST_AUTO_TEST_CASE(steiner_network_test) {
     BOOST_CHECK_EQUAL(result_network.size(), 4u);
 }
 
+BOOST_AUTO_TEST_CASE(steiner_network_cut_tree) {
+    VectorGraph g(3);
+    ResultNetwork result_network;
+    add_edge(0, 1, EdgeProp(0, 1), g);
+    add_edge(0, 1, EdgeProp(1, 1), g);
+    add_edge(1, 2, EdgeProp(2, 1), g);
+    add_edge(1, 2, EdgeProp(3, 1), g);
+    add_edge(2, 0, EdgeProp(4, 7), g);
+
+    steiner_network_iterative_rounding<lp::max_violated_separation_oracle,
+                                       cut_tree_separation>(
+        g, restrictions, std::back_inserter(result_network));
+
+    print_result(result_network);
+    BOOST_CHECK_EQUAL(result_network.size(), 4u);
+}
+
 BOOST_AUTO_TEST_CASE(steiner_network_list) {
     // boost::listS instead of boost::vecS for vertex storage
     using ListGraph =
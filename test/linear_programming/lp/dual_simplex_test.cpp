@@ -0,0 +1,188 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file dual_simplex_test.cpp
+ * @brief
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "paal/lp/dual_simplex.hpp"
+#include "paal/utils/irange.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace paal;
+
+namespace {
+
+// maximize c^T x, s.t. A x <= b, 0 <= x <= 10, with random sparse A >= 0
+struct random_lp {
+    random_lp(int rows, int cols) {
+        std::mt19937 generator(rows * cols);
+        std::uniform_real_distribution<double> value(1, 10);
+        std::bernoulli_distribution nonzero(0.1);
+        cost.resize(cols);
+        for (auto &c : cost) {
+            c = value(generator);
+        }
+        for (auto i : irange(rows)) {
+            bound.push_back(10 * value(generator));
+            for (auto j : irange(cols)) {
+                if (nonzero(generator)) {
+                    coefs.push_back({ i, j, value(generator) });
+                }
+            }
+        }
+    }
+
+    void build(lp::dual_simplex &lp) const {
+        lp.set_optimization_type(lp::MAXIMIZE);
+        cols.clear();
+        rows.clear();
+        for (auto c : cost) {
+            cols.push_back(lp.stage_column(c, 0, 10));
+        }
+        for (auto b : bound) {
+            rows.push_back(lp.stage_row(lp::lp_traits::MINUS_INF <=
+                                        lp::linear_expression() <= b));
+        }
+        for (auto const &coef : coefs) {
+            lp.stage_coefficient(rows[coef.row], cols[coef.col], coef.value);
+        }
+        lp.load_staged();
+    }
+
+    void check_feasible(const lp::dual_simplex &lp) const {
+        for (auto i : irange(rows.size())) {
+            BOOST_CHECK(lp.get_row_sum(rows[i]) <= bound[i] + 1e-6);
+        }
+        for (auto col : cols) {
+            BOOST_CHECK(lp.get_col_value(col) >= -1e-6);
+            BOOST_CHECK(lp.get_col_value(col) <= 10 + 1e-6);
+        }
+    }
+
+    struct coefficient {
+        int row;
+        int col;
+        double value;
+    };
+
+    std::vector<double> cost;
+    std::vector<double> bound;
+    std::vector<coefficient> coefs;
+    mutable std::vector<lp::col_id> cols;
+    mutable std::vector<lp::row_id> rows;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(dual_simplex)
+
+BOOST_AUTO_TEST_CASE(dual_simplex_warm_start) {
+    lp::dual_simplex lp("warm start", lp::MAXIMIZE);
+    auto X = lp.add_column(3, 0, 4);
+    auto Y = lp.add_column(2);
+    lp.add_row(X + Y <= 6);
+    lp.add_row(X - Y >= -2);
+
+    BOOST_CHECK_EQUAL(lp.solve_simplex(lp::DUAL), lp::OPTIMAL);
+    BOOST_CHECK_CLOSE(lp.get_obj_value(), 16, 1e-9);
+    BOOST_CHECK_EQUAL(lp.get_solve_statistics().warm_starts, 0);
+
+    // the new row cuts off the solution, the dual simplex continues
+    // from the previous basis
+    auto cut = lp.add_row(X + 2 * Y <= 7);
+    BOOST_CHECK_EQUAL(lp.resolve_simplex(lp::DUAL), lp::OPTIMAL);
+    BOOST_CHECK_CLOSE(lp.get_obj_value(), 15, 1e-9);
+    BOOST_CHECK_CLOSE(lp.get_col_value(X), 4, 1e-9);
+    BOOST_CHECK_CLOSE(lp.get_col_value(Y), 1.5, 1e-9);
+    BOOST_CHECK_CLOSE(lp.get_row_dual_value(cut), 1, 1e-9);
+    auto statistics = lp.get_solve_statistics();
+    BOOST_CHECK_EQUAL(statistics.solves, 2);
+    BOOST_CHECK_EQUAL(statistics.warm_starts, 1);
+
+    lp.delete_row(cut);
+    BOOST_CHECK_EQUAL(lp.resolve_simplex(lp::PRIMAL), lp::OPTIMAL);
+    BOOST_CHECK_CLOSE(lp.get_obj_value(), 16, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(dual_simplex_problem_types) {
+    {
+        lp::dual_simplex lp;
+        auto X = lp.add_column(1, lp::lp_traits::MINUS_INF);
+        lp.add_row(X <= 1);
+        BOOST_CHECK_EQUAL(lp.solve_simplex(lp::PRIMAL), lp::UNBOUNDED);
+        BOOST_CHECK_EQUAL(lp.solve_simplex(lp::DUAL), lp::UNBOUNDED);
+    }
+    {
+        lp::dual_simplex lp;
+        auto X = lp.add_column(1, 0, 1);
+        auto Y = lp.add_column(1, 0, 1);
+        lp.add_row(X + Y >= 3);
+        BOOST_CHECK_EQUAL(lp.solve_simplex(lp::PRIMAL), lp::INFEASIBLE);
+        BOOST_CHECK_EQUAL(lp.solve_simplex(lp::DUAL), lp::INFEASIBLE);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dual_simplex_coefficients) {
+    lp::dual_simplex lp;
+    auto X = lp.add_column(1);
+    auto Y = lp.add_column(1);
+    auto Z = lp.add_column(1);
+    auto row = lp.add_row(X + Y + Z >= 1);
+    lp.stage_coefficient(row, X, 2);
+    lp.stage_coefficient(row, Y, -1);
+    BOOST_CHECK_EQUAL(lp.get_row_degree(row), 2);
+    BOOST_CHECK_EQUAL(lp.get_col_degree(Y), 0);
+    BOOST_CHECK_CLOSE(lp.get_row_expression(row).get_elements().at(X), 3,
+                      1e-9);
+
+    lp.delete_col(X);
+    BOOST_CHECK_EQUAL(lp.get_row_degree(row), 1);
+    lp.set_row_expression(row, 2 * Y + Z);
+    BOOST_CHECK_EQUAL(lp.get_row_degree(row), 2);
+    BOOST_CHECK_EQUAL(lp.get_col_degree(Y), 1);
+    BOOST_CHECK_EQUAL(lp.solve_simplex(lp::DUAL), lp::OPTIMAL);
+    BOOST_CHECK_CLOSE(lp.get_obj_value(), 0.5, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(dual_simplex_many_pivots) {
+    // more pivots than between two refactorizations
+    const random_lp instance(150, 200);
+    lp::dual_simplex primal;
+    instance.build(primal);
+    BOOST_REQUIRE_EQUAL(primal.solve_simplex(lp::PRIMAL), lp::OPTIMAL);
+    BOOST_CHECK(primal.get_solve_statistics().iterations > 100);
+    instance.check_feasible(primal);
+
+    lp::dual_simplex dual;
+    instance.build(dual);
+    BOOST_REQUIRE_EQUAL(dual.solve_simplex(lp::DUAL), lp::OPTIMAL);
+    BOOST_CHECK(dual.get_solve_statistics().iterations > 100);
+    BOOST_CHECK_CLOSE(dual.get_obj_value(), primal.get_obj_value(), 1e-7);
+    instance.check_feasible(dual);
+
+    // the cut is resolved from the previous basis
+    lp::linear_expression objective;
+    for (auto j : irange(instance.cols.size())) {
+        objective += instance.cost[j] * instance.cols[j];
+    }
+    dual.add_row(objective <= primal.get_obj_value() / 2);
+    BOOST_REQUIRE_EQUAL(dual.resolve_simplex(lp::DUAL), lp::OPTIMAL);
+    instance.check_feasible(dual);
+    BOOST_CHECK_CLOSE(dual.get_obj_value(), primal.get_obj_value() / 2, 1e-7);
+    BOOST_CHECK_EQUAL(dual.get_solve_statistics().warm_starts, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,7 @@
 #include "test_utils/get_test_dir.hpp"
 #include "test_utils/system.hpp"
 
+#include "paal/lp/dual_simplex.hpp"
 #include "paal/lp/glp.hpp"
 #include "paal/utils/parse_file.hpp"
 
@@ -30,7 +31,7 @@
 #include <fstream>
 #include <unordered_map>
 
-using lp_types = boost::mpl::list<paal::lp::glp>;
+using lp_types = boost::mpl::list<paal::lp::glp, paal::lp::dual_simplex>;
 
 template <typename LP, typename RowBounds, typename ColBounds,
           typename CostCoefs, typename Coefficients>
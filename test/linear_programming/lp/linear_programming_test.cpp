@@ -15,6 +15,7 @@
 
 #include "test_utils/logger.hpp"
 
+#include "paal/lp/dual_simplex.hpp"
 #include "paal/lp/glp.hpp"
 #include "paal/utils/floating.hpp"
 #include "paal/utils/irange.hpp"
@@ -28,7 +29,7 @@
 
 using namespace paal;
 
-using lp_types = boost::mpl::list<lp::glp>;
+using lp_types = boost::mpl::list<lp::glp, lp::dual_simplex>;
 
 template <typename LP>
 void log_solution(lp::problem_type status, const LP &lp_instance) {
@@ -292,6 +293,49 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(linear_programming_methods, LP, lp_types) {
                       std::numeric_limits<double>::epsilon());
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(linear_programming_staged, LP, lp_types) {
+    LP lp("staged instance", lp::MAXIMIZE);
+    // the whole matrix is loaded at once
+    auto X = lp.stage_column(500, 0, lp::lp_traits::PLUS_INF, "x");
+    auto Y = lp.stage_column(300, 0, lp::lp_traits::PLUS_INF, "y");
+    auto row1 = lp.stage_row(X + Y <= 10, "row1");
+    auto row2 = lp.stage_row(lp::linear_expression(X, 150) <= 1200, "row2");
+    lp.stage_coefficient(row2, X, 50);
+    lp.stage_coefficient(row2, Y, 100);
+    auto row3 = lp.stage_row(X - Y >= -100, "row3");
+    lp.load_staged();
+
+    BOOST_CHECK_EQUAL(lp.columns_number(), 2);
+    BOOST_CHECK_EQUAL(lp.rows_number(), 3);
+    BOOST_CHECK_EQUAL(lp.get_col_name(Y), "y");
+    BOOST_CHECK_EQUAL(lp.get_row_name(row2), "row2");
+    BOOST_CHECK_EQUAL(lp.get_row_degree(row2), 2);
+    BOOST_CHECK_EQUAL(lp.get_col_degree(X), 3);
+
+    auto status = lp.solve_simplex(lp::PRIMAL);
+    BOOST_CHECK_EQUAL(status, lp::OPTIMAL);
+    BOOST_CHECK_SMALL(lp.get_obj_value() - 3400, 1e-9);
+
+    // staging to the LP with a non empty matrix
+    auto Z = lp.stage_column(100, 0, lp::lp_traits::PLUS_INF, "z");
+    auto row4 = lp.stage_row(Z + X <= 5, "row4");
+    lp.load_staged();
+    BOOST_CHECK_EQUAL(lp.get_row_degree(row1), 2);
+    BOOST_CHECK_EQUAL(lp.get_row_degree(row4), 2);
+
+    // bulk deletion
+    lp.delete_rows(std::vector<lp::row_id>{ row2, row3 });
+    lp.delete_cols(std::vector<lp::col_id>{ Z });
+    BOOST_CHECK_EQUAL(lp.rows_number(), 2);
+    BOOST_CHECK_EQUAL(lp.columns_number(), 2);
+    BOOST_CHECK_EQUAL(lp.get_row_name(row4), "row4");
+    BOOST_CHECK_EQUAL(lp.get_row_degree(row4), 1);
+
+    status = lp.resolve_simplex(lp::PRIMAL);
+    BOOST_CHECK_EQUAL(status, lp::OPTIMAL);
+    BOOST_CHECK_SMALL(lp.get_obj_value() - 4000, 1e-9);
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(linear_programming_zeros, LP, lp_types) {
     LP lp("test instance", lp::MAXIMIZE);
     auto X = lp.add_column();
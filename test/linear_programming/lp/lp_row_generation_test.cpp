@@ -0,0 +1,125 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file lp_row_generation_test.cpp
+ * @brief
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "paal/iterative_rounding/check_violation_functor.hpp"
+#include "paal/lp/lp_row_generation.hpp"
+#include "paal/utils/irange.hpp"
+
+#include <boost/optional.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <random>
+#include <vector>
+
+using namespace paal;
+
+namespace {
+
+using violation = boost::optional<double>;
+
+// every 7th candidate is violated, violations have many ties
+violation how_violated(int candidate) {
+    if (candidate % 7 != 3) {
+        return violation{};
+    }
+    return double((candidate * 37) % 11);
+}
+
+// checker with a state, which can not be used by two threads at once
+struct checker {
+    template <typename Problem>
+    violation check_violation(int candidate, const Problem &) {
+        if (m_busy.exchange(true)) {
+            shared = true;
+        }
+        auto ret = how_violated(candidate);
+        m_busy = false;
+        return ret;
+    }
+
+    checker() = default;
+    checker(const checker &) : m_busy(false) { ++copies; }
+
+    std::atomic<bool> m_busy{ false };
+    static std::atomic<int> copies;
+    // set if some checker was used by two threads at once
+    static std::atomic<bool> shared;
+};
+
+std::atomic<int> checker::copies{ 0 };
+std::atomic<bool> checker::shared{ false };
+
+template <typename Oracle, typename HowViolated, typename... Args>
+int added_candidate(Oracle oracle, HowViolated how, Args &&... args) {
+    auto candidates = irange(1000);
+    int added = -1;
+    auto find = oracle([&]() { return candidates; }, how,
+                       [&](int candidate) { added = candidate; },
+                       std::forward<Args>(args)...);
+    BOOST_CHECK(find());
+    return added;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(lp_row_generation)
+
+BOOST_AUTO_TEST_CASE(parallel_max_violated) {
+    auto serial = added_candidate(lp::max_violated_separation_oracle{}, how_violated);
+    for (unsigned threads : { 1, 2, 8 }) {
+        BOOST_CHECK_EQUAL(
+            added_candidate(lp::parallel_max_violated_separation_oracle{ threads },
+                            how_violated),
+            serial);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_first_violated) {
+    BOOST_CHECK_EQUAL(
+        added_candidate(lp::first_violated_separation_oracle{}, how_violated), 3);
+    for (unsigned threads : { 1, 2, 8 }) {
+        BOOST_CHECK_EQUAL(
+            added_candidate(lp::parallel_first_violated_separation_oracle{ threads },
+                            how_violated),
+            3);
+        BOOST_CHECK_EQUAL(
+            added_candidate(lp::parallel_random_violated_separation_oracle{ threads },
+                            how_violated, std::default_random_engine(7)),
+            added_candidate(lp::random_violated_separation_oracle{}, how_violated,
+                            std::default_random_engine(7)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_no_violated) {
+    auto candidates = irange(0);
+    auto find = lp::parallel_max_violated_separation_oracle{ 4 }(
+        [&]() { return candidates; }, how_violated, [](int) {});
+    BOOST_CHECK(!find());
+}
+
+BOOST_AUTO_TEST_CASE(parallel_with_cloned_checker) {
+    checker check;
+    int problem = 0;
+    auto how = ir::make_check_violation_functor(check, problem);
+    checker::copies = 0;
+    BOOST_CHECK_EQUAL(
+        added_candidate(lp::parallel_max_violated_separation_oracle{ 4 }, how),
+        added_candidate(lp::max_violated_separation_oracle{}, how));
+    BOOST_CHECK_EQUAL(checker::copies, 3);
+    BOOST_CHECK(!checker::shared);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
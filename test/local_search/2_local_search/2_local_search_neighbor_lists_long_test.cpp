@@ -0,0 +1,110 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file 2_local_search_neighbor_lists_long_test.cpp
+ * @brief 2-opt/Or-opt with neighbor lists on TSPLIB instances,
+ * times are printed with --log_level=message
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "test_utils/read_tsplib.hpp"
+#include "test_utils/test_result_check.hpp"
+#include "test_utils/get_test_dir.hpp"
+
+#include "paal/local_search/2_local_search/2_local_search.hpp"
+#include "paal/data_structures/cycle/cycle_algo.hpp"
+#include "paal/data_structures/cycle/simple_cycle.hpp"
+#include "paal/data_structures/cycle/splay_cycle.hpp"
+
+#include <boost/range/algorithm/sort.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace paal;
+
+namespace {
+
+template <typename Cycle>
+void check_permutation(const Cycle &cycle, std::size_t size) {
+    std::vector<int> visited(cycle.vbegin(), cycle.vend());
+    boost::sort(visited);
+    std::vector<int> all(size);
+    std::iota(all.begin(), all.end(), 0);
+    BOOST_CHECK(visited == all);
+}
+
+template <typename Cycle, typename Components>
+double search(read_tsplib::TSPLIB_Matrix const &mtx, std::vector<int> const &v,
+              Components lsc) {
+    Cycle cycle(v.begin(), v.end());
+    local_search::two_local_search(cycle, local_search::first_improving_strategy{},
+                                   utils::always_true{}, utils::always_false{}, lsc);
+    check_permutation(cycle, v.size());
+    return get_cycle_length(mtx, cycle);
+}
+
+// tours found from a random start are at most max_ratio times longer than the optimum
+// and max_average_ratio times longer on average
+template <typename Cycle>
+void run_neighbor_lists_search(const std::string &dir_path,
+                               const std::string &index, double max_ratio,
+                               double max_average_ratio) {
+    double ratios_sum = 0;
+    int instances = 0;
+    read_tsplib::TSPLIB_Directory dir(dir_path, index);
+    read_tsplib::TSPLIB_Matrix mtx;
+    std::string fname;
+    float opt;
+    std::default_random_engine engine;
+    while (dir.get_graph(fname, opt)) {
+        std::ifstream is(fname);
+        read_tsplib::TSPLIB_Directory::Graph g(is);
+        g.load(mtx);
+        auto size = mtx.size();
+        std::vector<int> v(size);
+        std::iota(v.begin(), v.end(), 0);
+        std::shuffle(v.begin(), v.end(), engine);
+        auto start = std::chrono::steady_clock::now();
+        double length;
+        if (mtx.X) {
+            // points in the plane, quadrant neighbors found using a grid
+            auto coordinates = [&](int i) { return std::make_pair(mtx.X[i], mtx.Y[i]); };
+            length = search<Cycle>(mtx, v, local_search::make_two_local_search_neighbor_components(
+                                                   mtx, v, coordinates));
+        } else {
+            length = search<Cycle>(mtx, v, local_search::make_two_local_search_neighbor_components(
+                                                   mtx, v));
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        BOOST_TEST_MESSAGE(fname << " (" << size << " vertices): "
+                           << std::chrono::duration<double>(end - start).count()
+                           << "s, length / optimum " << length / opt);
+        check_result(float(length), opt, max_ratio);
+        ratios_sum += length / opt;
+        ++instances;
+    }
+    BOOST_CHECK_LE(ratios_sum / instances, max_average_ratio);
+}
+
+} //!anonymous
+
+BOOST_AUTO_TEST_CASE(two_local_search_neighbor_lists_TSPLIB) {
+    run_neighbor_lists_search<data_structures::simple_cycle<int>>(
+        system::get_test_data_dir("TSPLIB/symmetrical"), "index", 1.35, 1.08);
+}
+
+BOOST_AUTO_TEST_CASE(two_local_search_neighbor_lists_TSPLIB_long) {
+    run_neighbor_lists_search<data_structures::splay_cycle<int>>(
+        system::get_test_data_dir("TSPLIB/symmetrical/long"), "index.long", 1.5, 1.15);
+}
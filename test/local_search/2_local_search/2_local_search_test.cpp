@@ -18,11 +18,16 @@
 
 #include "paal/local_search/2_local_search/2_local_search.hpp"
 #include "paal/data_structures/cycle/simple_cycle.hpp"
+#include "paal/data_structures/cycle/splay_cycle.hpp"
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <random>
 #include <vector>
 #include <string>
+#include <utility>
 
 using std::string;
 using std::vector;
@@ -57,3 +62,114 @@ BOOST_AUTO_TEST_CASE(two_local_search_test) {
                      utils::always_false(), lsc);
     //! [Two Local Search Example]
 }
+
+BOOST_AUTO_TEST_CASE(two_local_search_neighbor_lists_test) {
+    typedef sample_graphs_metrics SGM;
+    auto gm = SGM::get_graph_metric_small();
+    const int size = gm.size();
+    std::vector<int> v(size);
+    std::iota(v.begin(), v.end(), 0);
+    std::random_shuffle(v.begin(), v.end());
+    data_structures::simple_cycle<int> cycle(v.begin(), v.end());
+    data_structures::splay_cycle<int> splay(v.begin(), v.end());
+    auto length_before = get_cycle_length(gm, cycle);
+
+    auto lsc = make_two_local_search_neighbor_components(gm, v, 3);
+    two_local_search(cycle, first_improving_strategy{},
+                     utils::always_true{}, utils::always_false{}, lsc);
+    auto length_after = get_cycle_length(gm, cycle);
+    BOOST_CHECK(length_after <= length_before);
+    BOOST_CHECK_EQUAL(boost::distance(boost::make_iterator_range(cycle.vbegin(), cycle.vend())), size);
+    // don't look bits are on for all vertices
+    BOOST_CHECK(!tsp_first_improving(cycle, lsc));
+
+    two_local_search(splay, first_improving_strategy{}, utils::always_true{},
+                     utils::always_false{},
+                     make_two_local_search_neighbor_components(gm, v, 3));
+    BOOST_CHECK_EQUAL(get_cycle_length(gm, splay), length_after);
+}
+
+namespace {
+
+struct points_metric {
+    double operator()(int i, int j) const {
+        return std::hypot(points[i].first - points[j].first,
+                          points[i].second - points[j].second);
+    }
+    std::vector<std::pair<double, double>> points;
+};
+
+// quadrant neighbors computed from all the distances
+std::vector<int> brute_force_quadrant_neighbors(const points_metric &m, int i,
+                                                std::size_t neighbors_count) {
+    std::vector<std::pair<double, int>> all;
+    for (int j = 0; j < int(m.points.size()); ++j) {
+        if (j == i) continue;
+        auto dx = m.points[j].first - m.points[i].first;
+        auto dy = m.points[j].second - m.points[i].second;
+        all.emplace_back(dx * dx + dy * dy, j);
+    }
+    std::sort(all.begin(), all.end());
+    std::vector<int> result;
+    for (int quadrant = 0; quadrant < 4; ++quadrant) {
+        std::size_t found = 0;
+        for (auto const &c : all) {
+            auto dx = m.points[c.second].first - m.points[i].first;
+            auto dy = m.points[c.second].second - m.points[i].second;
+            if ((dx < 0 ? 1 : 0) + (dy < 0 ? 2 : 0) == quadrant &&
+                found++ < neighbors_count / 4) {
+                result.push_back(c.second);
+            }
+        }
+    }
+    for (auto const &c : all) {
+        if (result.size() == neighbors_count) break;
+        if (std::find(result.begin(), result.end(), c.second) == result.end()) {
+            result.push_back(c.second);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void check_quadrant_neighbors(const points_metric &m, std::size_t neighbors_count) {
+    std::vector<int> v(m.points.size());
+    std::iota(v.begin(), v.end(), 0);
+    auto coordinates = [&](int i) { return m.points[i]; };
+    tsp_neighbor_lists<points_metric> lists(m, v, neighbors_count, coordinates, 2);
+    for (auto i : v) {
+        auto neighbors = lists.get_neighbors(i);
+        BOOST_CHECK(std::is_sorted(neighbors.begin(), neighbors.end(), [&](int a, int b) {
+            return m(i, a) < m(i, b);
+        }));
+        std::vector<int> sorted(neighbors.begin(), neighbors.end());
+        std::sort(sorted.begin(), sorted.end());
+        BOOST_CHECK(sorted == brute_force_quadrant_neighbors(m, i, neighbors_count));
+    }
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(two_local_search_quadrant_neighbors_test) {
+    std::default_random_engine engine;
+    points_metric m;
+    // clusters, duplicated points and ties
+    std::uniform_int_distribution<int> coordinate(0, 20);
+    for (int i = 0; i < 300; ++i) {
+        int cluster = i % 3 * 1000;
+        m.points.emplace_back(cluster + coordinate(engine), coordinate(engine));
+    }
+    check_quadrant_neighbors(m, 12);
+    check_quadrant_neighbors(m, 7);
+
+    // points on a line
+    m.points.clear();
+    for (int i = 0; i < 50; ++i) {
+        m.points.emplace_back(i * i, 5);
+    }
+    check_quadrant_neighbors(m, 8);
+
+    // less points than neighbors
+    m.points.resize(5);
+    check_quadrant_neighbors(m, 8);
+}
@@ -57,3 +57,61 @@ BOOST_AUTO_TEST_CASE(FacilityLocationTest) {
                 best_improving_strategy{}, paal::utils::always_true{},
                 paal::utils::always_false{}, rem, add, swap));
 }
+
+BOOST_AUTO_TEST_CASE(FacilityLocationReadOnlySwapGainTest) {
+    typedef sample_graphs_metrics SGM;
+    auto g = SGM::get_graph_medium();
+    SGM::GraphMT gm(g);
+    std::vector<int> fcosts{ 7, 8, 30, 2, 11, 40, 5, 9, 13 };
+    auto cost = paal::utils::make_array_to_functor(fcosts);
+
+    typedef paal::data_structures::voronoi<decltype(gm)> VorType;
+    typedef paal::data_structures::facility_location_solution<decltype(cost),
+                                                              VorType> Sol;
+    typedef typename VorType::GeneratorsSet FSet;
+    FSet all{ SGM::A, SGM::B, SGM::C, SGM::D, SGM::E, SGM::F, SGM::G, SGM::H, SGM::I };
+    VorType voronoi(FSet{ SGM::A, SGM::E, SGM::I }, all, gm);
+    Sol sol(std::move(voronoi), FSet{ SGM::B, SGM::C, SGM::D, SGM::F, SGM::G, SGM::H }, cost);
+    facility_location_solution_adapter<Sol> adapter(sol);
+
+    facility_location_gain_swap gain;
+    facility_location_gain_swap_read_only read_only_gain;
+    facility_location_commit_swap commit;
+
+    // compare gains before and after commits (which invalidate the cache)
+    for (int round = 0; round < 3; ++round) {
+        Swap<int> best;
+        int best_gain = 0;
+        for (auto swap : facility_locationget_moves_swap{}(adapter)) {
+            auto expected = gain(adapter, swap);
+            BOOST_CHECK_EQUAL(read_only_gain(adapter, swap), expected);
+            if (expected > best_gain) {
+                best_gain = expected;
+                best = swap;
+            }
+        }
+        if (best_gain == 0) break;
+        commit(adapter, best);
+    }
+
+    // the same local optimum is reached with both gains
+    Sol sol_copy(VorType(FSet{ SGM::A, SGM::E, SGM::I }, all, gm),
+                 FSet{ SGM::B, SGM::C, SGM::D, SGM::F, SGM::G, SGM::H }, cost);
+    Sol sol_read_only(VorType(FSet{ SGM::A, SGM::E, SGM::I }, all, gm),
+                      FSet{ SGM::B, SGM::C, SGM::D, SGM::F, SGM::G, SGM::H }, cost);
+    facility_location_local_search(sol_copy, best_improving_strategy{},
+            paal::utils::always_true{}, paal::utils::always_false{},
+            default_swap_fl_components{});
+    facility_location_local_search(sol_read_only, best_improving_strategy{},
+            paal::utils::always_true{}, paal::utils::always_false{},
+            read_only_swap_fl_components{});
+    BOOST_CHECK(sol_copy.get_chosen_facilities() == sol_read_only.get_chosen_facilities());
+
+    // gains of swaps computed in parallel
+    Sol sol_parallel(VorType(FSet{ SGM::A, SGM::E, SGM::I }, all, gm),
+                     FSet{ SGM::B, SGM::C, SGM::D, SGM::F, SGM::G, SGM::H }, cost);
+    facility_location_local_search(sol_parallel, parallel_best_improving_strategy{4},
+            paal::utils::always_true{}, paal::utils::always_false{},
+            read_only_swap_fl_components{});
+    BOOST_CHECK(sol_copy.get_chosen_facilities() == sol_parallel.get_chosen_facilities());
+}
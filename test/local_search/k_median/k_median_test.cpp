@@ -42,3 +42,27 @@ BOOST_AUTO_TEST_CASE(kmedian_test) {
     LOGLN("Solution:");
     LOG_COPY_RANGE_DEL(ch, ",");
 }
+
+BOOST_AUTO_TEST_CASE(kmedian_read_only_gain_test) {
+    typedef sample_graphs_metrics SGM;
+    auto gm = SGM::get_graph_metric_small();
+
+    const int k = 2;
+    typedef paal::data_structures::voronoi<decltype(gm)> VorType;
+    typedef paal::data_structures::k_median_solution<VorType> Sol;
+    typedef paal::data_structures::voronoi_traits<VorType> VT;
+    typedef typename VT::GeneratorsSet GSet;
+    typedef typename VT::VerticesSet VSet;
+    typedef typename Sol::UnchosenFacilitiesSet USet;
+
+    VSet clients{ SGM::A, SGM::B, SGM::C, SGM::D, SGM::E };
+    Sol sol(VorType(GSet{ SGM::B, SGM::D }, clients, gm), USet{ SGM::A, SGM::C }, k);
+    Sol sol_read_only(VorType(GSet{ SGM::B, SGM::D }, clients, gm), USet{ SGM::A, SGM::C }, k);
+
+    paal::local_search::facility_location_first_improving(
+        sol, paal::local_search::default_k_median_components{});
+    paal::local_search::facility_location_first_improving(
+        sol_read_only, paal::local_search::read_only_k_median_components{});
+
+    BOOST_CHECK(sol.get_chosen_facilities() == sol_read_only.get_chosen_facilities());
+}
@@ -62,4 +62,58 @@ BOOST_AUTO_TEST_CASE(tabu_gain_adaptor_test) {
     LOGLN("solution " << best);
 }
 
+BOOST_AUTO_TEST_CASE(tabu_list_attribute_test) {
+    data_structures::tabu_list_attribute<> tabu(5, 2);
+    int solution(0);
+    BOOST_CHECK(!tabu.is_tabu(solution, 3));
+    tabu.accept(solution, 3);
+    BOOST_CHECK(tabu.is_tabu(solution, 3));
+    BOOST_CHECK(!tabu.is_tabu(solution, 4));
+    tabu.accept(solution, 4);
+    BOOST_CHECK(tabu.is_tabu(solution, 3));
+    tabu.accept(solution, 1);
+    // two moves were accepted after 3
+    BOOST_CHECK(!tabu.is_tabu(solution, 3));
+    BOOST_CHECK(tabu.is_tabu(solution, 4));
+    BOOST_CHECK(tabu.is_tabu(solution, 1));
+}
+
+BOOST_AUTO_TEST_CASE(tabu_gain_adaptor_aspiration_test) {
+    // moves 10, -10, 1, -1 have attributes 0, 1, 2, 3
+    auto attribute = [](int move) {
+        return (move < 0) + 2 * (std::abs(move) == 1);
+    };
+    auto run = [&](auto aspiration, int &best, int &current, int &bestValue) {
+        int currentSolution(0);
+        current = bestValue = f(currentSolution);
+        auto tabuGain = ls::make_tabu_gain_adaptor(
+            data_structures::make_tabu_list_attribute(4, 100, attribute),
+            gain{}, utils::always_true{}, aspiration);
+        auto recordSolutionCommit = ls::make_record_solution_commit_adapter(
+            best,
+            ls::make_track_objective_commit_adapter(commit(), f, current,
+                                                    bestValue),
+            paal::utils::make_functor_to_comparator(f));
+
+        ls::first_improving(currentSolution,
+                            ls::make_search_components(get_moves(), tabuGain,
+                                                       recordSolutionCommit));
+    };
+
+    // 0 -> 10 -> 9, then moves 10 and -1 are tabu
+    int best(0);
+    int current, bestValue;
+    run(utils::always_false{}, best, current, bestValue);
+    BOOST_CHECK_EQUAL(best, 9);
+    BOOST_CHECK_EQUAL(bestValue, f(9));
+
+    // tabu move -1 improves the best solution
+    best = 0;
+    run(ls::make_aspiration_beats_best(current, bestValue), best, current,
+        bestValue);
+    BOOST_CHECK_EQUAL(best, 6);
+    BOOST_CHECK_EQUAL(bestValue, f(6));
+    LOGLN("solution " << best);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -151,3 +151,16 @@ BOOST_AUTO_TEST_CASE(local_search_best_improving_test) {
                                logger, utils::always_false(), search_comps());
     BOOST_CHECK_EQUAL(f(sol), 1.);
 }
+
+BOOST_AUTO_TEST_CASE(local_search_parallel_best_improving_test) {
+    Solution sol(DIM, 0);
+    fill_rand(sol);
+    Solution sol_parallel = sol;
+
+    local_search::local_search(sol, local_search::best_improving_strategy{},
+                               utils::always_true(), utils::always_false(), search_comps());
+    local_search::local_search(sol_parallel, local_search::parallel_best_improving_strategy{4},
+                               utils::always_true(), utils::always_false(), search_comps());
+    BOOST_CHECK_EQUAL(f(sol_parallel), 1.);
+    BOOST_CHECK(sol == sol_parallel);
+}
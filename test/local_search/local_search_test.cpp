@@ -20,6 +20,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace ls = paal::local_search;
@@ -54,6 +56,16 @@ BOOST_AUTO_TEST_CASE(local_test) {
                                  nop, search_comps()));
     BOOST_CHECK_EQUAL(solution, 6);
 
+    solution = 0;
+    // parallel best improving
+    BOOST_CHECK(ls::local_search(solution, ls::parallel_best_improving_strategy{3},
+                                 log_action, nop, search_comps()));
+    BOOST_CHECK_EQUAL(solution, 6);
+
+    solution = 0;
+    BOOST_CHECK(ls::parallel_best_improving(solution, 2, search_comps()));
+    BOOST_CHECK_EQUAL(solution, 6);
+
     solution = 0;
 
     //best
@@ -68,4 +80,41 @@ BOOST_AUTO_TEST_CASE(local_test) {
 
 }
 
+BOOST_AUTO_TEST_CASE(parallel_best_improving_gain_throws) {
+    // only the gain of the first move, computed by the current thread,
+    // does not throw
+    auto throwing_gain = [](int s, int u) {
+        if (u != 10) {
+            throw std::runtime_error("gain failed");
+        }
+        return gain{}(s, u);
+    };
+    auto comps = ls::make_search_components(get_moves{}, throwing_gain,
+                                            commit{});
+    ls::parallel_best_improving_strategy strategy{ 3 };
+    for (int repeat = 0; repeat < 10; ++repeat) {
+        int solution = 0;
+        BOOST_CHECK_THROW(ls::local_search(solution, strategy,
+                                           paal::utils::always_true{},
+                                           paal::utils::always_false{}, comps),
+                          std::runtime_error);
+    }
+
+    // the threads are still usable
+    int solution = 0;
+    BOOST_CHECK(ls::local_search(solution, strategy, paal::utils::always_true{},
+                                 paal::utils::always_false{}, search_comps()));
+    BOOST_CHECK_EQUAL(solution, 6);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_best_improving_copy_of_moved) {
+    ls::parallel_best_improving_strategy strategy{ 2 };
+    auto moved = std::move(strategy);
+    auto copy = strategy;
+    int solution = 0;
+    BOOST_CHECK(ls::local_search(solution, copy, paal::utils::always_true{},
+                                 paal::utils::always_false{}, search_comps()));
+    BOOST_CHECK_EQUAL(solution, 6);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,140 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file multi_start_local_search_test.cpp
+ * @brief
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "test_utils/simple_single_local_search_components.hpp"
+#include "test_utils/logger.hpp"
+
+#include "paal/local_search/multi_start_local_search.hpp"
+#include "paal/local_search/simulated_annealing.hpp"
+#include "paal/local_search/custom_components.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(multi_start_local_search)
+
+namespace ls = paal::local_search;
+using namespace paal;
+
+BOOST_AUTO_TEST_CASE(shared_best_solution_test) {
+    ls::shared_best_solution<int, int> best;
+    BOOST_CHECK(best.update(1, f(1)));
+    BOOST_CHECK(!best.update(0, f(0)));
+    BOOST_CHECK(best.update(5, f(5)));
+    BOOST_CHECK_EQUAL(best.get_value(), f(5));
+    BOOST_CHECK_EQUAL(best.get_solution(), 5);
+
+    ls::shared_best_solution<int, int> concurrent;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int x = -100 + t; x <= 100; x += 4) {
+                concurrent.update(x, f(x));
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    BOOST_CHECK_EQUAL(concurrent.get_solution(), 6);
+    BOOST_CHECK_EQUAL(concurrent.get_solution_value(), f(6));
+}
+
+BOOST_AUTO_TEST_CASE(multi_start_first_improving_test) {
+    auto start = [](std::size_t i) { return -50 + 17 * int(i); };
+    auto components = [](std::size_t, int &) {
+        return ls::make_search_components(get_moves{}, gain{}, commit{});
+    };
+    for (unsigned threads : { 1, 4 }) {
+        auto best = ls::multi_start_local_search(
+            8, start, components, f, ls::first_improving_strategy{},
+            utils::always_true{}, utils::always_false{}, utils::always_false{},
+            threads);
+        BOOST_CHECK_EQUAL(best.first, 6);
+        BOOST_CHECK_EQUAL(best.second, f(6));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(multi_start_simulated_annealing_test) {
+    auto start = [](std::size_t i) { return 100 * int(i); };
+    auto components = [](std::size_t, int &best) {
+        auto sa_commit = ls::make_simulated_annealing_commit_adaptor(
+            commit{}, gain{},
+            ls::exponential_cooling_schema_dependant_on_iteration(1e3, 1 - 1e-3));
+        auto record_solution_commit = ls::make_record_solution_commit_adapter(
+            best, std::move(sa_commit), utils::make_functor_to_comparator(f));
+        // two packs, the second one is never used
+        return std::make_tuple(
+            ls::make_search_components(get_moves{}, gain{},
+                                       std::move(record_solution_commit)),
+            ls::make_search_components(get_moves{}, utils::return_zero_functor{},
+                                       commit{}));
+    };
+    // common time limit for all searches
+    ls::stop_condition_time_limit<std::chrono::milliseconds> time_limit(
+        std::chrono::milliseconds(100));
+    auto stop_cond = [=](int) mutable { return !time_limit(); };
+
+    auto best = ls::multi_start_local_search(
+        4, start, components, f, ls::best_strategy{}, stop_cond, stop_cond,
+        utils::always_false{}, 2);
+    BOOST_CHECK_EQUAL(best.first, 6);
+    LOGLN("solution " << best.first);
+}
+
+BOOST_AUTO_TEST_CASE(multi_start_stragglers_test) {
+    // the first search starts at the optimum, the other ones are stopped
+    // after the first step
+    auto start = [](std::size_t i) { return i == 0 ? 6 : 1000; };
+    std::atomic<int> steps{ 0 };
+    auto count_steps = [&](int) {
+        ++steps;
+        return true;
+    };
+    auto components = [](std::size_t, int &) {
+        return ls::make_search_components(get_moves{}, gain{}, commit{});
+    };
+    auto best = ls::multi_start_local_search(
+        4, start, components, f, ls::first_improving_strategy{}, count_steps,
+        utils::always_false{}, ls::stop_condition_behind_best<int>(1000), 1, 1);
+    BOOST_CHECK_EQUAL(best.first, 6);
+    BOOST_CHECK_EQUAL(steps, 0);
+}
+
+BOOST_AUTO_TEST_CASE(multi_start_offer_period_test) {
+    // 11 steps from -50 to 6
+    auto start = [](std::size_t) { return -50; };
+    auto components = [](std::size_t, int &) {
+        return ls::make_search_components(get_moves{}, gain{}, commit{});
+    };
+    for (std::size_t period : {1, 10, 100}) {
+        int evaluations = 0;
+        auto objective = [&](int x) {
+            ++evaluations;
+            return f(x);
+        };
+        auto best = ls::multi_start_local_search(
+            1, start, components, objective, ls::first_improving_strategy{},
+            utils::always_true{}, utils::always_false{}, utils::always_false{}, 1, period);
+        BOOST_CHECK_EQUAL(best.first, 6);
+        // offers during the search and of the final and the recorded solution
+        BOOST_CHECK_EQUAL(evaluations, 11 / period + 2);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,84 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file n_queens_conflicts.cpp
+ * @brief benchmark of n queens local search with compact counters and
+ * moves of queens in conflict, reports moves per second
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "paal/local_search/n_queens/n_queens_local_search.hpp"
+#include "paal/local_search/custom_components.hpp"
+#include "paal/data_structures/components/components_replace.hpp"
+
+#include <boost/range/algorithm_ext/iota.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char **argv) {
+    if (argc > 3) {
+        std::cout << argv[0] << " "
+                  << "max_number_of_queens=10000000 seconds_per_size=10"
+                  << std::endl;
+        return 1;
+    }
+    const int max_number_of_queens = argc > 1 ? std::stoi(argv[1]) : 10000000;
+    const int seconds = argc > 2 ? std::stoi(argv[2]) : 10;
+
+    namespace ls = paal::local_search;
+    using clock = std::chrono::steady_clock;
+    typedef ls::n_queens_compact_solution_adapter<std::vector<int>> Adapter;
+    std::default_random_engine engine;
+
+    for (int n = 10000; n <= max_number_of_queens; n *= 10) {
+        std::vector<int> queens(n);
+        boost::iota(queens, 0);
+        std::shuffle(queens.begin(), queens.end(), engine);
+
+        auto start = clock::now();
+        Adapter adapter(queens);
+        auto start_conflicts = adapter.obj_fun();
+
+        auto comps = ls::make_n_queens_conflicts_components();
+        auto get_moves = comps.get<ls::GetMoves>();
+        long long nr_of_moves(0);
+        auto counting_gain = paal::utils::make_counting_functor_adaptor(
+            comps.get<ls::Gain>(), nr_of_moves);
+        auto counting_comps =
+            paal::data_structures::replace<ls::Gain>(counting_gain, comps);
+
+        ls::stop_condition_time_limit<std::chrono::seconds, clock> time_limit(
+            std::chrono::seconds{ seconds });
+        auto continue_on_fail = [&](const Adapter &) {
+            return get_moves.candidates_count() > 0 && !time_limit();
+        };
+        auto continue_on_success = [&](const Adapter &) { return !time_limit(); };
+
+        auto search_start = clock::now();
+        ls::local_search(adapter, ls::first_improving_strategy{},
+                         continue_on_success, continue_on_fail, counting_comps);
+        auto end = clock::now();
+
+        auto search_time = std::chrono::duration<double>(end - search_start).count();
+        std::cout << "n = " << n << ", initialization "
+                  << std::chrono::duration<double>(search_start - start).count()
+                  << "s, search " << search_time << "s, moves " << nr_of_moves
+                  << ", moves/sec " << nr_of_moves / search_time
+                  << ", conflicts " << start_conflicts << " -> "
+                  << adapter.obj_fun() << std::endl;
+    }
+
+    return 0;
+}
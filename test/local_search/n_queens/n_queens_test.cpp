@@ -39,3 +39,56 @@ BOOST_AUTO_TEST_CASE(n_queens_test) {
         LOGLN("end obj fun val = " << Adapter(queens).obj_fun());
     }
 }
+
+BOOST_AUTO_TEST_CASE(n_queens_conflicts_test) {
+    namespace ls = paal::local_search;
+    typedef ls::n_queens_compact_solution_adapter<std::vector<int>> Adapter;
+    for (int i : { 100, 1000, 10000 }) {
+        std::vector<int> queens(i);
+        boost::iota(queens, 0);
+        boost::random_shuffle(queens);
+        Adapter adapter(queens);
+        auto start = adapter.obj_fun();
+        LOGLN("n = " << i << " start obj fun val = " << start);
+
+        auto comps = ls::make_n_queens_conflicts_components();
+        auto get_moves = comps.get<ls::GetMoves>();
+        int fails = 0;
+        auto continue_on_fail = [&](const Adapter &) {
+            return get_moves.candidates_count() > 0 && ++fails < 100000;
+        };
+        ls::local_search(adapter, ls::first_improving_strategy{},
+                         paal::utils::always_true{}, continue_on_fail, comps);
+        auto end = adapter.obj_fun();
+        LOGLN("end obj fun val = " << end);
+        // the search might get stuck in a local minimum
+        BOOST_CHECK(10 * end < start);
+        BOOST_CHECK_EQUAL(end == 0, get_moves.candidates_count() == 0);
+        BOOST_CHECK_EQUAL(Adapter(queens).obj_fun(), end);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(n_queens_conflicts_reuse_test) {
+    namespace ls = paal::local_search;
+    typedef ls::n_queens_compact_solution_adapter<std::vector<int>> Adapter;
+    // the same components for a restart and for a smaller solution
+    auto comps = ls::make_n_queens_conflicts_components();
+    auto get_moves = comps.get<ls::GetMoves>();
+    for (int i : { 1000, 1000, 200 }) {
+        std::vector<int> queens(i);
+        boost::iota(queens, 0);
+        boost::random_shuffle(queens);
+        Adapter adapter(queens);
+        auto start = adapter.obj_fun();
+
+        int fails = 0;
+        auto continue_on_fail = [&](const Adapter &) {
+            return get_moves.candidates_count() > 0 && ++fails < 100000;
+        };
+        ls::local_search(adapter, ls::first_improving_strategy{},
+                         paal::utils::always_true{}, continue_on_fail, comps);
+        auto end = adapter.obj_fun();
+        BOOST_CHECK(10 * end < start);
+        BOOST_CHECK_EQUAL(end == 0, get_moves.candidates_count() == 0);
+    }
+}
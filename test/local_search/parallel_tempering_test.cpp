@@ -0,0 +1,94 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file parallel_tempering_test.cpp
+ * @brief
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "test_utils/simple_single_local_search_components.hpp"
+#include "test_utils/logger.hpp"
+
+#include "paal/local_search/parallel_tempering.hpp"
+#include "paal/local_search/custom_components.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+
+BOOST_AUTO_TEST_SUITE(parallel_tempering)
+
+namespace ls = paal::local_search;
+using namespace paal;
+
+namespace {
+
+// many local maxima: every multiple of 10 is a local maximum
+// for moves +-1, the global maximum is at 200
+int rugged(int x) {
+    return -std::abs(x - 200) + (x % 10 == 0 ? 100 : 0);
+}
+
+struct rugged_gain {
+    int operator()(int s, int u) const { return rugged(s + u) - rugged(s); }
+};
+
+struct unit_moves {
+    const std::vector<int> &operator()(int) const { return m_moves; }
+    std::vector<int> m_moves{ 1, -1 };
+};
+
+} //!anonymous
+
+BOOST_AUTO_TEST_CASE(geometric_temperatures_test) {
+    auto temperatures = ls::geometric_temperatures(1, 1000, 4);
+    BOOST_REQUIRE_EQUAL(temperatures.size(), 4);
+    BOOST_CHECK_CLOSE(temperatures[0], 1, 1e-9);
+    BOOST_CHECK_CLOSE(temperatures[1], 10, 1e-9);
+    BOOST_CHECK_CLOSE(temperatures[3], 1000, 1e-9);
+    BOOST_CHECK_EQUAL(ls::geometric_temperatures(2, 5, 1).size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_tempering_test) {
+    auto start = [](std::size_t i) { return 100 * int(i); };
+    auto components = [](std::size_t i, int &best, auto get_temperature) {
+        auto sa_gain = ls::make_simulated_annealing_gain_adaptor(
+            gain{}, get_temperature, std::default_random_engine(i));
+        auto record_solution_commit = ls::make_record_solution_commit_adapter(
+            best, commit{}, utils::make_functor_to_comparator(f));
+        return ls::make_search_components(get_moves{}, std::move(sa_gain),
+                                          std::move(record_solution_commit));
+    };
+    auto best = ls::parallel_tempering(
+        start, ls::geometric_temperatures(0.1, 100, 4), components, f,
+        ls::first_improving_strategy{}, ls::stop_condition_count_limit(100), 20);
+    BOOST_CHECK_EQUAL(best.first, 6);
+    BOOST_CHECK_EQUAL(best.second, f(6));
+}
+
+BOOST_AUTO_TEST_CASE(parallel_tempering_rugged_test) {
+    // the cold replica alone gets stuck in the local maximum at 0
+    auto start = [](std::size_t) { return 0; };
+    auto components = [](std::size_t i, int &best, auto get_temperature) {
+        auto sa_gain = ls::make_simulated_annealing_gain_adaptor(
+            rugged_gain{}, get_temperature, std::default_random_engine(i));
+        auto record_solution_commit = ls::make_record_solution_commit_adapter(
+            best, commit{}, utils::make_functor_to_comparator(rugged));
+        return ls::make_search_components(unit_moves{}, std::move(sa_gain),
+                                          std::move(record_solution_commit));
+    };
+    auto best = ls::parallel_tempering(
+        start, ls::geometric_temperatures(0.5, 50, 6), components, rugged,
+        ls::first_improving_strategy{}, ls::stop_condition_count_limit(2000), 50);
+    BOOST_CHECK_EQUAL(best.first, 200);
+    LOGLN("solution " << best.first);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file search_statistics_test.cpp
+ * @brief
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "test_utils/simple_single_local_search_components.hpp"
+
+#include "paal/data_structures/tabu_list/tabu_list.hpp"
+#include "paal/local_search/custom_components.hpp"
+#include "paal/local_search/search_statistics.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(search_statistics)
+
+namespace ls = paal::local_search;
+
+BOOST_AUTO_TEST_CASE(instrumented_components_test) {
+    int solution(0);
+    ls::search_statistics statistics("shift");
+    ls::first_improving(solution,
+                        ls::make_instrumented_components(search_comps(), statistics));
+    BOOST_CHECK_EQUAL(solution, 6);
+
+    // 0 -> 10 -> 9 -> 8 -> 7 -> 6, the first move from 0 is improving
+    // from 10, 9, 8, 7 the last one is improving, from 6 none
+    BOOST_CHECK_EQUAL(statistics.get_moves_calls, 6);
+    BOOST_CHECK_EQUAL(statistics.moves_evaluated, 1 + 4 * 5);
+    BOOST_CHECK_EQUAL(statistics.improving_moves, 5);
+    BOOST_CHECK_EQUAL(statistics.commits, 5);
+    BOOST_CHECK_EQUAL(statistics.improvement, f(6) - f(0));
+    BOOST_REQUIRE_EQUAL(statistics.iterations.size(), 5);
+    BOOST_CHECK_EQUAL(statistics.iterations[0].moves_evaluated, 1);
+    BOOST_CHECK_EQUAL(statistics.iterations[1].moves_evaluated, 4);
+    BOOST_CHECK_EQUAL(statistics.iterations[0].gain, f(10) - f(0));
+    BOOST_CHECK(statistics.gain_seconds >= 0);
+
+    std::vector<ls::search_statistics> all{ statistics };
+    std::ostringstream json;
+    ls::write_statistics_json(json, all);
+    BOOST_CHECK(json.str().find("\"name\": \"shift\"") != std::string::npos);
+    BOOST_CHECK(json.str().find("\"moves_evaluated\": 21") != std::string::npos);
+
+    std::ostringstream csv;
+    ls::write_statistics_csv(csv, all);
+    std::string line;
+    std::istringstream lines(csv.str());
+    int rows = 0;
+    while (std::getline(lines, line)) {
+        ++rows;
+    }
+    BOOST_CHECK_EQUAL(rows, 1 + 5);
+}
+
+BOOST_AUTO_TEST_CASE(instrumented_components_gain_not_recomputed) {
+    int calls = 0;
+    auto counting_gain = [&](int s, int u) {
+        ++calls;
+        return gain{}(s, u);
+    };
+    int solution(0);
+    ls::search_statistics statistics;
+    ls::best_improving(solution,
+                       ls::make_instrumented_components(
+                           ls::make_search_components(get_moves{}, counting_gain,
+                                                      commit{}),
+                           statistics));
+    BOOST_CHECK_EQUAL(solution, 6);
+    BOOST_CHECK_EQUAL(calls, statistics.moves_evaluated);
+    BOOST_REQUIRE_EQUAL(statistics.iterations.size(), 5);
+    int gains[] = { f(10) - f(0), f(9) - f(10), f(8) - f(9), f(7) - f(8),
+                    f(6) - f(7) };
+    for (int i = 0; i < 5; ++i) {
+        BOOST_CHECK_EQUAL(statistics.iterations[i].gain, gains[i]);
+    }
+    BOOST_CHECK_EQUAL(statistics.improvement, f(6) - f(0));
+}
+
+BOOST_AUTO_TEST_CASE(instrumented_components_tabu_gain) {
+    // moves 10, -10, 1, -1 have attributes 0, 1, 2, 3
+    auto attribute = [](int move) {
+        return (move < 0) + 2 * (std::abs(move) == 1);
+    };
+    auto tabu_gain = ls::make_tabu_gain_adaptor(
+        paal::data_structures::make_tabu_list_attribute(4, 100, attribute),
+        gain{});
+    int solution(0);
+    ls::search_statistics statistics;
+    ls::first_improving(solution,
+                        ls::make_instrumented_components(
+                            ls::make_search_components(get_moves{}, tabu_gain,
+                                                       commit{}),
+                            statistics));
+    // 0 -> 10 -> 9, the accepted moves are tabu after the commit
+    BOOST_CHECK_EQUAL(solution, 9);
+    BOOST_REQUIRE_EQUAL(statistics.iterations.size(), 2);
+    BOOST_CHECK_EQUAL(statistics.iterations[0].gain, f(10) - f(0));
+    BOOST_CHECK_EQUAL(statistics.iterations[1].gain, f(9) - f(10));
+}
+
+BOOST_AUTO_TEST_CASE(statistics_export_escaping) {
+    ls::search_statistics statistics("a,\"b\"\n\t\x01");
+    statistics.iterations.push_back(ls::iteration_statistics{ 1, 2, 3 });
+    std::vector<ls::search_statistics> all{ statistics };
+
+    std::ostringstream json;
+    ls::write_statistics_json(json, all);
+    BOOST_CHECK(json.str().find(R"("name": "a,\"b\"\n\t\u0001")") !=
+                std::string::npos);
+
+    std::ostringstream csv;
+    ls::write_statistics_csv(csv, all);
+    BOOST_CHECK(csv.str().find("\n\"a,\"\"b\"\"\n\t\x01\",0,") !=
+                std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
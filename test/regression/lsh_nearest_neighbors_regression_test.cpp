@@ -17,15 +17,23 @@
 #include "test_utils/serialization.hpp"
 
 #include "paal/regression/lsh_nearest_neighbors_regression.hpp"
+#include "paal/regression/lsh_nearest_neighbors_regression_mapped.hpp"
 #include "paal/utils/irange.hpp"
 
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/binary_oarchive.hpp>
+#include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/vector_sparse.hpp>
+#include <boost/range/algorithm/copy.hpp>
 #include <boost/range/empty.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <iterator>
+#include <random>
 #include <vector>
 #include <utility>
 #include <string>
@@ -164,6 +172,11 @@ std::vector<point_sparse_coordinates_t> make_jaccard_points(std::vector<point_co
 }
 
 
+struct constant_hash {
+    template <typename Range>
+    std::size_t operator()(Range &&) const { return 0; }
+};
+
 auto make_sparse(std::vector<double> const &list) {
     point_sparse_coordinates_t point(list.size());
     for (auto index : paal::irange(list.size())) {
@@ -273,6 +286,49 @@ BOOST_AUTO_TEST_CASE(update_changes_model) {
     LOGLN("end");
 }
 
+BOOST_AUTO_TEST_CASE(batch_test_same_as_sequential) {
+    LOGLN("batch_test_same_as_sequential");
+    std::vector<point_coordinates_t> training_points;
+    std::vector<result_t> training_results;
+    std::vector<point_coordinates_t> test_points;
+    for (auto i : paal::irange(100)) {
+        training_points.push_back({i % 7, i % 5, i % 3});
+        training_results.push_back(i % 2);
+        test_points.push_back({i % 3, i % 7, i % 5});
+    }
+    auto model = make_model(hamming_tag{}, training_points, training_results);
+
+    std::vector<result_t> expected_results(test_points.size());
+    model.test(test_points, expected_results.begin());
+
+    for (auto threads_count : {1, 3}) {
+        for (auto block_size : {1, 7, 1000}) {
+            LOGLN("threads_count: " << threads_count << ", block_size: " << block_size);
+            std::vector<result_t> results;
+            model.test(test_points, std::back_inserter(results), threads_count, block_size);
+            BOOST_CHECK(results == expected_results);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(colliding_fingerprints) {
+    LOGLN("colliding_fingerprints");
+    // all hash values have the same fingerprint, buckets differ by full hash values
+    std::vector<point_coordinates_t> training_points = {{0, 0}, {1, 1}};
+    std::vector<result_t> training_results = {0.0, 1.0};
+    auto const hash_functions_per_row = 50;
+    auto generator = paal::make_hash_function_tuple_generator(
+            paal::lsh::hamming_hash_function_generator{2}, hash_functions_per_row);
+    using lsh_fun = decltype(generator());
+    using hash_result = paal::pure_result_of_t<lsh_fun(point_coordinates_t)>;
+    paal::lsh_nearest_neighbors_regression<hash_result, lsh_fun, constant_hash> model(
+            training_points, training_results, default_passes, generator);
+    test(model, training_points, training_results);
+    for (auto const & map : model.get_hash_maps()) {
+        BOOST_CHECK_EQUAL(map.size(), 2);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(serialization) {
     LOGLN("serialize");
     serialize_test(make_model(hamming_tag{}, {{0, 1}, {2, 3}}, {0.0, 0.2}), TMP_FILE);
@@ -285,5 +341,122 @@ BOOST_AUTO_TEST_CASE(serialization) {
     serialize_test(make_lp<paal::lsh::l_2_hash_function_generator<>>({p1, p2}, {0.0, 0.2}), TMP_FILE);
 }
 
+BOOST_AUTO_TEST_CASE(packed_l_p_hash_function_tuple) {
+    LOGLN("packed_l_p_hash_function_tuple");
+    using dense_t = boost::numeric::ublas::vector<double>;
+    std::vector<point_sparse_coordinates_t> sparse_points;
+    std::vector<dense_t> dense_points;
+    std::default_random_engine engine;
+    std::uniform_int_distribution<int> coordinate(-3, 3);
+    for (auto i : paal::irange(20)) {
+        std::vector<double> coordinates(10);
+        for (auto &c : coordinates) c = (i % 3 == 0) ? coordinate(engine) : 0.0;
+        coordinates[i % 10] = coordinate(engine);
+        sparse_points.push_back(make_sparse(coordinates));
+        dense_points.emplace_back(coordinates.size());
+        boost::copy(coordinates, dense_points.back().begin());
+    }
+
+    auto const dimensions = 10;
+    auto const hash_functions_per_row = 7;
+    auto tuples = paal::make_hash_function_tuple_generator(
+            paal::lsh::l_2_hash_function_generator<>{dimensions, 2.0}, hash_functions_per_row);
+    auto packed = paal::lsh::make_l_p_hash_function_tuple_generator(
+            paal::lsh::l_2_hash_function_generator<>{dimensions, 2.0}, hash_functions_per_row);
+    for (int pass = 0; pass < 5; ++pass) {
+        auto tuple_fun = tuples();
+        auto packed_fun = packed();
+        for (auto i : paal::irange(dense_points.size())) {
+            BOOST_CHECK(tuple_fun(dense_points[i]) == packed_fun(dense_points[i]));
+            BOOST_CHECK(tuple_fun(sparse_points[i]) == packed_fun(sparse_points[i]));
+        }
+    }
+
+    auto model = paal::make_lsh_nearest_neighbors_regression(
+            sparse_points, std::vector<result_t>(sparse_points.size(), 1.0),
+            default_passes, packed);
+    serialize_test(model, TMP_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_model) {
+    LOGLN("mapped_model");
+    auto fname = paal::system::get_temp_file_path("mapped_model.bin");
+    std::vector<point_coordinates_t> training_points;
+    std::vector<result_t> training_results;
+    for (auto i : paal::irange(100)) {
+        training_points.push_back({i % 7, i % 5, i % 3});
+        training_results.push_back(i % 2);
+    }
+    std::vector<point_coordinates_t> test_points = {{0, 0, 0}, {1, 2, 3}, {14, -7, 1}};
+    auto model = make_model(hamming_tag{}, training_points, training_results);
+    std::vector<result_t> expected_results;
+    model.test(test_points, std::back_inserter(expected_results));
+
+    paal::save_mapped_lsh_nearest_neighbors_regression(model, fname);
+    {
+        auto mapped_model = paal::load_mapped_lsh_nearest_neighbors_regression<decltype(model)>(fname);
+        test(mapped_model, test_points, expected_results);
+
+        std::vector<result_t> results;
+        mapped_model.test(test_points, std::back_inserter(results), 2, 2);
+        BOOST_CHECK(results == expected_results);
+    }
+    paal::system::remove_tmp_path(fname);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_model_truncated) {
+    LOGLN("mapped_model_truncated");
+    auto fname = paal::system::get_temp_file_path("mapped_model.bin");
+    auto truncated_fname = paal::system::get_temp_file_path("mapped_model_truncated.bin");
+    std::vector<point_coordinates_t> training_points;
+    std::vector<result_t> training_results;
+    for (auto i : paal::irange(100)) {
+        training_points.push_back({i % 7, i % 5, i % 3});
+        training_results.push_back(i % 2);
+    }
+    auto model = make_model(hamming_tag{}, training_points, training_results);
+    using model_t = decltype(model);
+    paal::save_mapped_lsh_nearest_neighbors_regression(model, fname);
+
+    std::string contents;
+    {
+        std::ifstream ifs(fname, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+    auto write_truncated = [&](std::string const & data) {
+        std::ofstream ofs(truncated_fname, std::ios::binary);
+        ofs.write(data.data(), data.size());
+    };
+
+    // every prefix of the file misses some of the data
+    std::vector<std::size_t> sizes = {1, sizeof(paal::detail::mapped_model_header),
+        sizeof(paal::detail::mapped_model_header) + 1, contents.size() / 2, contents.size() - 1};
+    for (auto size : sizes) {
+        write_truncated(contents.substr(0, size));
+        BOOST_CHECK_THROW(paal::load_mapped_lsh_nearest_neighbors_regression<model_t>(truncated_fname),
+                          std::runtime_error);
+    }
+
+    // number of passes, which makes the size of the tables directory overflow
+    auto corrupted = contents;
+    // power of two, so that only the overflow check can reject it
+    std::uint64_t const huge = std::uint64_t(1) << 62;
+    std::memcpy(&corrupted[offsetof(paal::detail::mapped_model_header, passes)], &huge, sizeof(huge));
+    write_truncated(corrupted);
+    BOOST_CHECK_THROW(paal::load_mapped_lsh_nearest_neighbors_regression<model_t>(truncated_fname),
+                      std::runtime_error);
+
+    // table capacity, which makes the size of the slots array overflow
+    corrupted = contents;
+    std::memcpy(&corrupted[sizeof(paal::detail::mapped_model_header) +
+                           offsetof(paal::detail::mapped_model_table, capacity)], &huge, sizeof(huge));
+    write_truncated(corrupted);
+    BOOST_CHECK_THROW(paal::load_mapped_lsh_nearest_neighbors_regression<model_t>(truncated_fname),
+                      std::runtime_error);
+
+    paal::system::remove_tmp_path(fname);
+    paal::system::remove_tmp_path(truncated_fname);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,81 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file frequent_directions_compress_long_test.cpp
+ * @brief compares compress methods of frequent_directions,
+ * times are printed with --log_level=message
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "test_utils/sketch_accuracy_check.hpp"
+
+#include "paal/sketch/frequent_directions.hpp"
+#include "paal/utils/irange.hpp"
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <random>
+
+namespace {
+
+using coordinate_t = double;
+using matrix_t = boost::numeric::ublas::matrix<coordinate_t>;
+
+matrix_t generate_low_rank_matrix(std::size_t rows_count, std::size_t columns_count,
+                                  std::size_t rank, std::default_random_engine & generator) {
+    std::normal_distribution<coordinate_t> distribution;
+    matrix_t left(rows_count, rank), right(rank, columns_count);
+    for (auto & x : left.data()) x = distribution(generator);
+    for (auto & x : right.data()) x = distribution(generator);
+    matrix_t noise(rows_count, columns_count);
+    for (auto & x : noise.data()) x = 0.01 * distribution(generator);
+    return boost::numeric::ublas::prod(left, right) + noise;
+}
+
+template <typename CompressTag>
+auto sketch_matrix(matrix_t const & data, std::size_t sketch_size, double & seconds) {
+    auto fd_sketch = paal::make_frequent_directions<coordinate_t, CompressTag>(sketch_size, data.size2());
+    auto start = std::chrono::steady_clock::now();
+    fd_sketch.update(data);
+    fd_sketch.compress();
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return fd_sketch.get_sketch().first;
+}
+
+} //! anonymous
+
+BOOST_AUTO_TEST_CASE(frequent_directions_compress_methods) {
+    std::default_random_engine generator;
+    struct sizes { std::size_t rows, columns, rank, sketch; };
+
+    for (auto s : {sizes{2000, 50, 10, 100}, sizes{2000, 200, 20, 50},
+                   sizes{2000, 500, 30, 100}, sizes{1000, 1000, 50, 200}}) {
+        auto data = generate_low_rank_matrix(s.rows, s.columns, s.rank, generator);
+
+        double svd_seconds, gram_seconds;
+        auto svd_sketch = sketch_matrix<paal::svd_compress_tag>(data, s.sketch, svd_seconds);
+        auto gram_sketch = sketch_matrix<paal::gram_compress_tag>(data, s.sketch, gram_seconds);
+
+        BOOST_TEST_MESSAGE("rows " << s.rows << " columns " << s.columns << " sketch rows " << s.sketch
+                           << ": gesvd " << svd_seconds << "s, gram " << gram_seconds << "s");
+
+        auto const data_norm = boost::numeric::ublas::norm_frobenius(data);
+        auto const eps = 1e-9 * data_norm * data_norm;
+        check_frequent_directions(matrix_t(data), matrix_t(gram_sketch), eps);
+
+        // both methods compute the same covariance of the sketch
+        matrix_t svd_covariance = boost::numeric::ublas::prod(boost::numeric::ublas::trans(svd_sketch), svd_sketch);
+        matrix_t gram_covariance = boost::numeric::ublas::prod(boost::numeric::ublas::trans(gram_sketch), gram_sketch);
+        BOOST_CHECK_SMALL(boost::numeric::ublas::norm_frobenius(svd_covariance - gram_covariance) /
+                          (data_norm * data_norm), 1e-6);
+    }
+}
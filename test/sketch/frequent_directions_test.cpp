@@ -180,6 +180,79 @@ BOOST_AUTO_TEST_CASE(compress_size) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(gram_compress) {
+    for(auto compress_size : compress_sizes) {
+        auto fd_sketch = paal::make_frequent_directions<coordinate_t, paal::gram_compress_tag>
+            (sketch_size, columns_count, compress_size);
+        auto data_matrix = generate_data_matrix();
+
+        fd_sketch.update(data_matrix);
+        fd_sketch.compress();
+
+        auto sketch = fd_sketch.get_sketch().first;
+        check_frequent_directions(std::move(data_matrix), std::move(sketch),
+                EPS, coordinate_t(compress_size));
+    }
+
+    // more columns than rows of the sketch
+    std::size_t const wide_columns_count = 7;
+    auto fd_sketch = paal::make_frequent_directions<coordinate_t, paal::gram_compress_tag>
+        (sketch_size, wide_columns_count);
+    matrix_t data_matrix(rows_count, wide_columns_count);
+    for (auto i : paal::irange(rows_count)) {
+        for (auto j : paal::irange(wide_columns_count)) {
+            data_matrix(i, j) = coordinate_t((i * j + i + 2 * j) % 5) - 2;
+        }
+    }
+
+    fd_sketch.update(data_matrix);
+    fd_sketch.compress();
+
+    auto sketch = fd_sketch.get_sketch().first;
+    check_frequent_directions(std::move(data_matrix), std::move(sketch), EPS);
+}
+
+BOOST_AUTO_TEST_CASE(merge) {
+    auto data_matrix = generate_data_matrix();
+    auto fd_sketch = paal::make_frequent_directions<coordinate_t>(sketch_size, columns_count);
+    auto fd_other = paal::make_frequent_directions<coordinate_t>(sketch_size, columns_count);
+
+    for (auto i : paal::irange(data_matrix.size1())) {
+        matrix_row_t row(data_matrix, i);
+        if (i % 2) {
+            fd_sketch.update_row(row);
+        } else {
+            fd_other.update_row(row);
+        }
+    }
+    fd_sketch.merge(fd_other);
+    fd_sketch.compress();
+
+    auto sketch = fd_sketch.get_sketch().first;
+    check_frequent_directions(std::move(data_matrix), std::move(sketch), EPS);
+}
+
+BOOST_AUTO_TEST_CASE(update_range_threads) {
+    std::size_t const big_rows_count = 1000;
+    std::size_t const big_sketch_size = 6;
+    matrix_t data_matrix(big_rows_count, columns_count);
+    data_t rows;
+    for (auto i : paal::irange(big_rows_count)) {
+        rows.push_back({coordinate_t(i % 7), coordinate_t(i % 11) - 5, coordinate_t(i % 3) * 2});
+        matrix_row_t row(data_matrix, i);
+        boost::copy(rows.back(), row.begin());
+    }
+
+    for (unsigned threads_count : {1, 2, 3, 8}) {
+        auto fd_sketch = paal::make_frequent_directions<coordinate_t>(big_sketch_size, columns_count);
+        fd_sketch.update_range(rows, threads_count);
+        fd_sketch.compress();
+
+        auto sketch = fd_sketch.get_sketch().first;
+        check_frequent_directions(matrix_t(data_matrix), std::move(sketch), EPS);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(serialization) {
     auto fd_sketch = paal::make_frequent_directions<coordinate_t>(sketch_size, columns_count);
     auto data_matrix = generate_data_matrix();
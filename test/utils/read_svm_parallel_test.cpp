@@ -0,0 +1,169 @@
+//=======================================================================
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+/**
+ * @file read_svm_parallel_test.cpp
+ * @brief
+ * @author agent
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "test_utils/get_test_dir.hpp"
+
+#include "paal/utils/irange.hpp"
+#include "paal/utils/read_svm.hpp"
+#include "paal/utils/read_svm_parallel.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using coordinates_type = std::vector<double>;
+
+void check_float(std::string const &number) {
+    double value;
+    char const * it = number.data();
+    BOOST_CHECK(paal::detail::parse_svm_float(it, number.data() + number.size(), value));
+    BOOST_CHECK(it == number.data() + number.size());
+    BOOST_CHECK_EQUAL(value, std::strtod(number.c_str(), nullptr));
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(read_svm_parallel_tests)
+
+BOOST_AUTO_TEST_CASE(parse_float) {
+    for (auto number : {"0", "1", "-1", "+2.5", "1.", ".5", "1e-6", "1.5E3", "0.000123",
+                        "123456789.987654321", "3.14159265358979323846264338327950288",
+                        "1e300", "-2.2250738585072014e-308", "0.1", "0.3", "7e22", "9e-23"}) {
+        check_float(number);
+    }
+
+    double value;
+    for (std::string number : {"", "-", ".", "e5", "1e", "abc"}) {
+        char const * it = number.data();
+        BOOST_CHECK(!paal::detail::parse_svm_float(it, number.data() + number.size(), value));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parse_integer_overflow) {
+    auto parse = [](std::string const &number, auto &value) {
+        char const * it = number.data();
+        return paal::detail::parse_svm_integer(it, number.data() + number.size(), value);
+    };
+    int value;
+    BOOST_CHECK(parse("2147483647", value));
+    BOOST_CHECK_EQUAL(value, 2147483647);
+    BOOST_CHECK(parse("-2147483648", value));
+    BOOST_CHECK_EQUAL(value, std::numeric_limits<int>::min());
+    BOOST_CHECK(parse("-0", value));
+    BOOST_CHECK_EQUAL(value, 0);
+    BOOST_CHECK(!parse("2147483648", value));
+    BOOST_CHECK(!parse("-2147483649", value));
+    BOOST_CHECK(!parse("99999999999999999999", value));
+
+    std::size_t id;
+    BOOST_CHECK(parse("18446744073709551615", id));
+    BOOST_CHECK_EQUAL(id, std::numeric_limits<std::size_t>::max());
+    BOOST_CHECK(!parse("18446744073709551616", id));
+
+    //feature id which does not fit is a bad row
+    std::string const data = "1 18446744073709551616:1\n0 1:2";
+    std::size_t dimensions = 0;
+    auto rows = paal::read_svm_parallel(data.data(), data.size(), 2, dimensions,
+                                        paal::utils::always_true{}, 1);
+    BOOST_CHECK_EQUAL(rows.size(), 1);
+    BOOST_CHECK_EQUAL(dimensions, 2);
+}
+
+BOOST_AUTO_TEST_CASE(zero_threads) {
+    std::string const data = "1 0:1";
+    std::size_t dimensions = 0;
+    BOOST_CHECK_THROW(paal::read_svm_parallel(data.data(), data.size(), 1, dimensions,
+                                              paal::utils::always_false{}, 0),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(same_as_read_svm) {
+    std::default_random_engine engine;
+    std::uniform_int_distribution<int> features(0, 10);
+    std::uniform_int_distribution<int> feature_id(0, 99);
+    std::uniform_real_distribution<double> value(-100, 100);
+    std::stringstream input;
+    input.precision(17);
+    for (int row = 0; row < 1000; ++row) {
+        input << (row % 3 == 0 ? "1" : "-1");
+        auto features_count = features(engine);
+        for (int f = 0; f < features_count; ++f) {
+            input << (f % 2 ? " " : "\t") << feature_id(engine) << ":" << value(engine);
+        }
+        input << (row % 5 ? "\n" : " \r\n");
+    }
+    auto const file = paal::system::create_tmp_file("read_svm_parallel", input.str());
+
+    std::size_t expected_dimensions = 100;
+    std::vector<std::tuple<coordinates_type, int>> expected_rows;
+    paal::read_svm(input, expected_dimensions, expected_rows, 2000);
+
+    for (auto threads_count : paal::irange(1, 5)) {
+        std::size_t dimensions = 0;
+        auto rows = paal::read_svm_parallel(file, 100, dimensions, paal::utils::always_false{}, threads_count);
+        BOOST_CHECK_EQUAL(dimensions, expected_dimensions);
+        BOOST_REQUIRE_EQUAL(rows.size(), expected_rows.size());
+        for (auto i : paal::irange(rows.size())) {
+            coordinates_type coordinates(100);
+            for (auto j : paal::irange(rows.get_feature_ids(i).size())) {
+                coordinates[rows.get_feature_ids(i)[j]] = rows.get_values(i)[j];
+            }
+            BOOST_CHECK(coordinates == std::get<0>(expected_rows[i]));
+            BOOST_CHECK_EQUAL(rows.results[i], std::get<1>(expected_rows[i]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(bad_rows_with_offsets) {
+    std::string const data = "1 0:4 1:5\n0 abc:4\n1 0:4 4:99 1:5\n1 0 4\n0 1:2";
+    using bad_row = std::pair<std::string, std::size_t>;
+    std::vector<bad_row> const expected_bad_rows = {
+        bad_row{"0 abc:4", 10}, bad_row{"1 0:4 4:99 1:5", 18}, bad_row{"1 0 4", 33}};
+
+    for (auto threads_count : paal::irange(1, 4)) {
+        std::vector<bad_row> bad_rows;
+        auto ignore = [&](std::string const &line, std::size_t offset) {
+            bad_rows.emplace_back(line, offset);
+            return true;
+        };
+        std::size_t dimensions = 0;
+        auto rows = paal::read_svm_parallel(data.data(), data.size(), 2, dimensions, ignore, threads_count);
+        std::sort(bad_rows.begin(), bad_rows.end(),
+                  [](bad_row const &lhs, bad_row const &rhs) { return lhs.second < rhs.second; });
+        BOOST_CHECK(bad_rows == expected_bad_rows);
+        BOOST_CHECK_EQUAL(rows.size(), 2);
+        BOOST_CHECK_EQUAL(dimensions, 2);
+        BOOST_CHECK_EQUAL(rows.results[0], 1);
+        BOOST_CHECK_EQUAL(rows.results[1], 0);
+        BOOST_CHECK_EQUAL(rows.get_values(1).front(), 2);
+    }
+
+    //bad rows are kept
+    std::size_t dimensions = 0;
+    auto rows = paal::read_svm_parallel(data.data(), data.size(), 2, dimensions);
+    BOOST_CHECK_EQUAL(rows.size(), 5);
+    BOOST_CHECK_EQUAL(dimensions, 5);
+    BOOST_CHECK_EQUAL(rows.get_feature_ids(2).size(), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()